@@ -0,0 +1,486 @@
+/*
+ * Copyright (c) 2025 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "config/b4g_config.h"
+#include "config/pgm_conf.h"
+#include "diagnostic.h"
+#include "nlohmann/json.hpp"
+#include "utils/path.h"
+#include "utils/path_conversions.h"
+#include "utils/platform.h"
+#include "utils/unicode_text.h"
+#include "workspace_manager.h"
+
+/*
+ * The batch analyzer checks all programs of a workspace without an editor, e.g. in a CI pipeline.
+ * Programs defined in the workspace's pgm_conf.json or .bridge.json are distributed among worker threads. Every
+ * worker owns a workspace manager which is reused for all programs it analyzes, so libraries and macro caches are
+ * loaded once per worker. Diagnostics are written to stdout (or a file) as a json or SARIF document, progress is
+ * reported to stderr.
+ *
+ * Accepted parameters:
+ * -p path       - Specifies a path to the folder with .hlasmplugin (current directory by default)
+ * -g path       - Specifies a path to the folder with .bridge.json
+ * -j count      - Number of worker threads (number of hardware threads by default)
+ * -f format     - Output format, json (default) or sarif
+ * -o file       - Writes the output to the file instead of stdout
+ *
+ * Exit code is 0 when no program reported an error, 2 when some did, and 1 on invalid parameters.
+ *
+ * Reported data (json format):
+ * - programs     - List of analyzed programs with their diagnostics, error and warning counts and wall time
+ * - total        - Number of programs, errors, warnings, workers and the wall time of the whole analysis
+ */
+
+using json = nlohmann::json;
+using namespace hlasm_plugin;
+
+namespace {
+
+template<typename... Args>
+void log_i(Args... args)
+{
+    (std::clog << ... << args) << std::endl;
+}
+
+template<typename... Args>
+void log_e(Args... args)
+{
+    ((std::clog << "Error: ") << ... << args) << std::endl;
+}
+
+enum class output_format
+{
+    json,
+    sarif,
+};
+
+struct batch_configuration
+{
+    std::string ws_folder = utils::path::current_path().string();
+    std::optional<std::string> b4g_pgms_dir;
+    size_t workers = std::max(1u, std::thread::hardware_concurrency());
+    output_format format = output_format::json;
+    std::optional<std::string> output_file;
+    std::vector<std::string> pgm_names;
+
+    bool load(int argc, char** argv)
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            const std::string_view arg = argv[i];
+            if (i + 1 >= argc)
+            {
+                log_e("Unknown parameter or missing value ", arg);
+                return false;
+            }
+            const std::string_view value = argv[++i];
+
+            if (arg == "-p")
+                ws_folder = utils::path::absolute(value).string();
+            else if (arg == "-g")
+                b4g_pgms_dir = std::string(value);
+            else if (arg == "-j")
+            {
+                try
+                {
+                    workers = std::max<size_t>(1, std::stoul(std::string(value)));
+                }
+                catch (...)
+                {
+                    log_e("Numeric value expected for ", arg);
+                    return false;
+                }
+            }
+            else if (arg == "-f" && value == "json")
+                format = output_format::json;
+            else if (arg == "-f" && value == "sarif")
+                format = output_format::sarif;
+            else if (arg == "-o")
+                output_file = std::string(value);
+            else
+            {
+                log_e("Unknown parameter or invalid value ", arg, ' ', value);
+                return false;
+            }
+        }
+
+        return load_programs();
+    }
+
+private:
+    bool load_programs()
+    {
+        bool some_config_exists = false;
+
+        if (parser_library::config::pgm_conf pgm_conf;
+            retrieve_config(pgm_conf, ws_folder + "/.hlasmplugin/pgm_conf.json"))
+        {
+            some_config_exists = true;
+            for (const auto& pgm : pgm_conf.pgms)
+                pgm_names.emplace_back(pgm.program);
+        }
+
+        if (parser_library::config::b4g_map b4g_conf;
+            b4g_pgms_dir.has_value() && retrieve_config(b4g_conf, *b4g_pgms_dir + "/.bridge.json"))
+        {
+            some_config_exists = true;
+            for (const auto& [file, _] : b4g_conf.files)
+                pgm_names.emplace_back(*b4g_pgms_dir + "/" + file);
+        }
+
+        if (!some_config_exists)
+            log_e("No program configuration found in ", ws_folder);
+
+        return some_config_exists;
+    }
+
+    template<typename T>
+    static bool retrieve_config(T& configuration, const std::string& path)
+    {
+        auto cfg_o = utils::platform::read_file(path);
+        if (!cfg_o.has_value())
+            return false;
+
+        try
+        {
+            json::parse(cfg_o.value(), nullptr, true, true).get_to(configuration);
+        }
+        catch (...)
+        {
+            return false;
+        }
+
+        return true;
+    }
+};
+
+struct program_result
+{
+    std::string file;
+    std::string uri;
+    bool success = false;
+    std::string reason;
+    long long time_ms = 0;
+    std::vector<parser_library::diagnostic> diagnostics;
+
+    size_t count(parser_library::diagnostic_severity s) const
+    {
+        return std::ranges::count(diagnostics, s, &parser_library::diagnostic::severity);
+    }
+};
+
+// keeps the diagnostics from the last notification, the workspace manager always reports all of them
+struct diagnostic_collector final : public parser_library::diagnostics_consumer
+{
+    void consume_diagnostics(std::span<const parser_library::diagnostic> diagnostics,
+        std::span<const parser_library::fade_message>) override
+    {
+        last.assign(diagnostics.begin(), diagnostics.end());
+    }
+
+    std::vector<parser_library::diagnostic> last;
+};
+
+class worker
+{
+    const batch_configuration& m_cfg;
+    diagnostic_collector m_diags;
+    std::unique_ptr<parser_library::workspace_manager> m_ws;
+
+    void reset()
+    {
+        m_ws = parser_library::create_workspace_manager();
+        m_ws->register_diagnostics_consumer(&m_diags);
+        m_ws->add_workspace(m_cfg.ws_folder, utils::path::path_to_uri(m_cfg.ws_folder));
+        m_ws->idle_handler();
+    }
+
+public:
+    explicit worker(const batch_configuration& cfg)
+        : m_cfg(cfg)
+    {
+        reset();
+    }
+
+    void analyze(program_result& r)
+    {
+        const auto source_path = utils::path::join(m_cfg.ws_folder, r.file).string();
+        r.uri = utils::path::path_to_uri(source_path);
+
+        const auto content = utils::platform::read_file(source_path);
+        if (!content.has_value())
+        {
+            r.reason = "Read error";
+            return;
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        try
+        {
+            m_ws->did_open_file(r.uri, 1, utils::replace_non_utf8_chars(*content));
+            m_ws->idle_handler();
+            r.time_ms =
+                std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+            r.diagnostics = std::move(m_diags.last);
+            r.success = true;
+
+            m_ws->did_close_file(r.uri);
+            m_ws->idle_handler();
+        }
+        catch (const std::exception& e)
+        {
+            r.reason = e.what();
+        }
+        catch (...)
+        {
+            r.reason = "Crash";
+        }
+        m_diags.last.clear();
+
+        // the state of the workspace manager is unknown after a failure
+        if (!r.success)
+            reset();
+    }
+};
+
+void analyze_programs(const batch_configuration& cfg, std::span<program_result> results, std::atomic<size_t>& next)
+{
+    worker w(cfg);
+    for (size_t i; (i = next.fetch_add(1, std::memory_order_relaxed)) < results.size();)
+    {
+        auto& r = results[i];
+        w.analyze(r);
+        log_i(r.file, ": ", r.success ? "done" : r.reason, " (", r.time_ms, " ms)");
+    }
+}
+
+std::string_view severity_name(parser_library::diagnostic_severity s)
+{
+    switch (s)
+    {
+        case parser_library::diagnostic_severity::error:
+            return "error";
+        case parser_library::diagnostic_severity::warning:
+            return "warning";
+        case parser_library::diagnostic_severity::info:
+            return "info";
+        case parser_library::diagnostic_severity::hint:
+            return "hint";
+        default:
+            return "unspecified";
+    }
+}
+
+std::string_view sarif_level(parser_library::diagnostic_severity s)
+{
+    switch (s)
+    {
+        case parser_library::diagnostic_severity::error:
+            return "error";
+        case parser_library::diagnostic_severity::warning:
+            return "warning";
+        default:
+            return "note";
+    }
+}
+
+json position_json(const parser_library::position& p) { return { { "line", p.line }, { "character", p.column } }; }
+
+json to_json_document(std::span<const program_result> results, size_t workers, long long time_ms)
+{
+    json programs = json::array();
+    size_t errors = 0;
+    size_t warnings = 0;
+    for (const auto& r : results)
+    {
+        json diags = json::array();
+        for (const auto& d : r.diagnostics)
+        {
+            diags.push_back({
+                { "uri", d.file_uri },
+                {
+                    "range",
+                    { { "start", position_json(d.diag_range.start) }, { "end", position_json(d.diag_range.end) } },
+                },
+                { "severity", severity_name(d.severity) },
+                { "code", d.code },
+                { "message", d.message },
+            });
+        }
+        const auto e = r.count(parser_library::diagnostic_severity::error);
+        const auto w = r.count(parser_library::diagnostic_severity::warning);
+        errors += e;
+        warnings += w;
+
+        json program = {
+            { "file", r.file },
+            { "success", r.success },
+            { "time_ms", r.time_ms },
+            { "errors", e },
+            { "warnings", w },
+            { "diagnostics", std::move(diags) },
+        };
+        if (!r.success)
+            program["reason"] = r.reason;
+        programs.push_back(std::move(program));
+    }
+
+    return {
+        { "programs", std::move(programs) },
+        {
+            "total",
+            {
+                { "programs", results.size() },
+                { "errors", errors },
+                { "warnings", warnings },
+                { "workers", workers },
+                { "time_ms", time_ms },
+            },
+        },
+    };
+}
+
+json to_sarif_document(std::span<const program_result> results)
+{
+    json sarif_results = json::array();
+    json invocations_notifications = json::array();
+    for (const auto& r : results)
+    {
+        if (!r.success)
+        {
+            invocations_notifications.push_back({
+                { "level", "error" },
+                { "message", { { "text", r.file + ": " + r.reason } } },
+            });
+        }
+        for (const auto& d : r.diagnostics)
+        {
+            sarif_results.push_back({
+                { "ruleId", d.code },
+                { "level", sarif_level(d.severity) },
+                { "message", { { "text", d.message } } },
+                {
+                    "locations",
+                    json::array({
+                        {
+                            {
+                                "physicalLocation",
+                                {
+                                    { "artifactLocation", { { "uri", d.file_uri } } },
+                                    {
+                                        "region",
+                                        {
+                                            { "startLine", d.diag_range.start.line + 1 },
+                                            { "startColumn", d.diag_range.start.column + 1 },
+                                            { "endLine", d.diag_range.end.line + 1 },
+                                            { "endColumn", d.diag_range.end.column + 1 },
+                                        },
+                                    },
+                                },
+                            },
+                        },
+                    }),
+                },
+                { "properties", { { "program", r.uri }, { "time_ms", r.time_ms } } },
+            });
+        }
+    }
+
+    return {
+        { "$schema", "https://json.schemastore.org/sarif-2.1.0.json" },
+        { "version", "2.1.0" },
+        {
+            "runs",
+            json::array({
+                {
+                    { "tool", { { "driver", { { "name", "HLASM Language Support" } } } } },
+                    {
+                        "invocations",
+                        json::array({
+                            {
+                                { "executionSuccessful", std::ranges::all_of(results, &program_result::success) },
+                                { "toolExecutionNotifications", std::move(invocations_notifications) },
+                            },
+                        }),
+                    },
+                    { "results", std::move(sarif_results) },
+                },
+            }),
+        },
+    };
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    batch_configuration cfg;
+    if (!cfg.load(argc, argv))
+        return 1;
+
+    std::vector<program_result> results(cfg.pgm_names.size());
+    for (size_t i = 0; i < results.size(); ++i)
+        results[i].file = cfg.pgm_names[i];
+
+    const auto workers = std::min(cfg.workers, std::max<size_t>(1, results.size()));
+    log_i("Analyzing ", results.size(), " programs with ", workers, " workers");
+
+    const auto start = std::chrono::steady_clock::now();
+    std::atomic<size_t> next = 0;
+    {
+        std::vector<std::jthread> threads;
+        threads.reserve(workers);
+        for (size_t i = 0; i < workers; ++i)
+            threads.emplace_back([&cfg, &results, &next]() { analyze_programs(cfg, results, next); });
+    }
+    const auto time_ms =
+        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+
+    const auto document =
+        cfg.format == output_format::sarif ? to_sarif_document(results) : to_json_document(results, workers, time_ms);
+
+    if (cfg.output_file)
+    {
+        std::ofstream out(*cfg.output_file);
+        out << document.dump(2) << '\n';
+        if (!out)
+        {
+            log_e("Unable to write ", *cfg.output_file);
+            return 1;
+        }
+    }
+    else
+        std::cout << document.dump(2) << '\n';
+
+    log_i("Finished in ", time_ms, " ms");
+
+    const bool errors_found = std::ranges::any_of(results, [](const auto& r) {
+        return !r.success || r.count(parser_library::diagnostic_severity::error) > 0;
+    });
+    return errors_found ? 2 : 0;
+}
@@ -15,10 +15,12 @@
 #include <algorithm>
 #include <chrono>
 #include <ctime>
+#include <filesystem>
 #include <format>
 #include <iostream>
 #include <limits>
 #include <optional>
+#include <random>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -32,6 +34,7 @@
 #include "utils/platform.h"
 #include "utils/resource_location.h"
 #include "utils/unicode_text.h"
+#include "workload_generator.h"
 #include "workspace_manager.h"
 
 /*
@@ -48,6 +51,10 @@
  * -s            - Skips reparsing of each file
  * -m message    - Prepends message before every log entry related to parsed files
  * -g path       - Specifies a path to the folder with .bridge.json
+ * -y spec       - Generates a synthetic workspace and benchmarks it. The workspace is written to the folder
+ *                 specified by -p (a new temporary folder removed on exit by default). The spec is a comma
+ *                 separated list of key=value pairs: programs, statements, macros, macro_depth, macro_calls,
+ *                 copy_fanout, ca_loop, forward_refs, libraries and seed (e.g. -y programs=50,macro_depth=8)
  *
  * Collected metrics:
  * - File                     - File name
@@ -70,8 +77,13 @@
  * - Continued Statements     - Number of statements that were continued (multiple continuations of one statement count
  *as one continued statement)
  * - Non-continued Statements - Number of statements that were not continued
+ * - Using Evaluations        - Number of base register resolutions through the active USING context
+ * - Using Evaluation Cache Hits - Using Evaluations answered from the memoized results
  * - Lines                    - Total number of lines
  * - Files                    - Total number of parsed files
+ * - Memory ... (B)           - Approximate number of bytes retained after the parsing by highlighting info,
+ *                              LSP context, diagnostics, outputs, macro cache and identifier storage
+ * - Memory Total (B)         - Sum of the above
  */
 
 using namespace hlasm_plugin;
@@ -115,6 +127,46 @@ struct parsing_metadata_collector final : public parser_library::parsing_metadat
     std::vector<parser_library::parsing_metadata> data;
 };
 
+// directory removed together with its content when the owner is destroyed
+class temporary_directory
+{
+    std::filesystem::path m_path;
+
+public:
+    explicit temporary_directory(std::filesystem::path path)
+        : m_path(std::move(path))
+    {}
+    temporary_directory(const temporary_directory&) = delete;
+    temporary_directory& operator=(const temporary_directory&) = delete;
+    ~temporary_directory()
+    {
+        std::error_code ec;
+        std::filesystem::remove_all(m_path, ec);
+        if (ec)
+            log_w("Unable to remove temporary directory ", m_path.string());
+    }
+
+    const std::filesystem::path& path() const { return m_path; }
+
+    // creates a new uniquely named directory in the system temporary folder
+    static std::optional<std::filesystem::path> create_unique(std::string_view prefix)
+    {
+        std::error_code ec;
+        const auto tmp = std::filesystem::temp_directory_path(ec);
+        if (ec)
+            return std::nullopt;
+
+        std::random_device rd;
+        for (int attempt = 0; attempt < 16; ++attempt)
+        {
+            auto candidate = tmp / (std::string(prefix) + std::to_string(rd()));
+            if (std::filesystem::create_directory(candidate, ec))
+                return candidate;
+        }
+        return std::nullopt;
+    }
+};
+
 class bench_configuration
 {
 public:
@@ -126,12 +178,16 @@ public:
     std::string message;
     std::vector<std::string> pgm_names;
     std::optional<std::string> b4g_pgms_dir = std::nullopt;
+    std::optional<benchmark::workload_parameters> synthetic = std::nullopt;
 
     bool load(int argc, char** argv)
     {
         if (!load_options(argc, argv))
             return false;
 
+        if (synthetic && !generate_synthetic_workspace())
+            return false;
+
         load_programs_to_parse();
         return true;
     }
@@ -146,11 +202,16 @@ public:
             log_i("write_details: ", write_details);
             log_i("do_reparse: ", do_reparse);
             log_i("message: ", message);
+            if (synthetic)
+                log_i("synthetic: ", synthetic->to_string());
             log_if("number of pgms: ", pgm_names.size(), "\n\n");
         }
     }
 
 private:
+    bool ws_folder_specified = false;
+    std::optional<temporary_directory> synthetic_folder;
+
     bool load_options(int argc, char** argv)
     {
         const auto advance_and_retrieve = [argc, &argv](std::string_view option, auto& i, auto& s) {
@@ -195,6 +256,7 @@ private:
                 if (!advance_and_retrieve(arg, i, ws_folder))
                     return false;
                 ws_folder = utils::path::absolute(ws_folder).string();
+                ws_folder_specified = true;
             }
             else if (arg == "-c") // Cycle parameter, loop infinitely single file
             {
@@ -210,6 +272,18 @@ private:
                 if (!advance_and_retrieve(arg, i, b4g_pgms_dir))
                     return false;
             }
+            else if (arg == "-y") // Generates synthetic workspace
+            {
+                std::string spec;
+                if (!advance_and_retrieve(arg, i, spec))
+                    return false;
+                synthetic = benchmark::workload_parameters::parse(spec);
+                if (!synthetic)
+                {
+                    log_e("Invalid synthetic workspace specification: ", spec);
+                    return false;
+                }
+            }
             else if (arg == "-m") // Specifies annotation of each "Parsing <file>" message
             {
                 if (!advance_and_retrieve(arg, i, message))
@@ -225,6 +299,31 @@ private:
         return true;
     }
 
+    bool generate_synthetic_workspace()
+    {
+        if (!ws_folder_specified)
+        {
+            auto folder = temporary_directory::create_unique("hlasm_synthetic_workspace_");
+            if (!folder)
+            {
+                log_e("Unable to create temporary directory");
+                return false;
+            }
+            ws_folder = synthetic_folder.emplace(std::move(*folder)).path().string();
+        }
+
+        if (!benchmark::generate_workload(*synthetic, ws_folder))
+        {
+            log_e("Unable to generate synthetic workspace in ", ws_folder);
+            return false;
+        }
+
+        if (end_range == 0)
+            end_range = synthetic->programs;
+
+        return true;
+    }
+
     void load_programs_to_parse()
     {
         bool some_config_exists = false;
@@ -351,7 +450,8 @@ public:
                                   { "Analyzer crashes", s.parsing_crashes },
                                   { "Failed program opens", s.failed_file_opens },
                                   { "Average statement/ms", s.average_stmt_ms / bc.pgm_names.size() },
-                                  { "Average line/ms", s.average_line_ms / bc.pgm_names.size() } })
+                                  { "Average line/ms", s.average_line_ms / bc.pgm_names.size() },
+                                  { "Max Memory Total (B)", s.max_memory } })
                              .dump(2);
             std::cout << "}\n";
             log_if("Parse finished\n\n");
@@ -371,6 +471,7 @@ private:
         size_t parsing_crashes = 0;
         size_t reparsing_crashes = 0;
         size_t failed_file_opens = 0;
+        size_t max_memory = 0;
     };
 
     struct parse_time_stats
@@ -474,6 +575,8 @@ private:
             log_i("Reparsed Statements: ", first_parse_metrics.reparsed_statements);
             log_i("Continued Statements: ", first_parse_metrics.continued_statements);
             log_i("Non-continued Statements: ", first_parse_metrics.non_continued_statements);
+            log_i("Using Evaluations: ", first_parse_metrics.using_evaluations);
+            log_i("Using Evaluation Cache Hits: ", first_parse_metrics.using_evaluation_cache_hits);
             log_i("Lines: ", first_parse_metrics.lines);
             log_i("Executed Statement/ms: ", (double)exec_statements / (double)parse_time);
             log_i("Line/ms: ", (double)first_parse_metrics.lines / (double)parse_time);
@@ -525,6 +628,7 @@ private:
         s.average_line_ms += metrics.lines / (double)time;
         s.all_files += files_processed;
         s.whole_time += time;
+        s.max_memory = std::max(s.max_memory, metadata.memory.total());
 
         return parse_results {
             true,
@@ -548,8 +652,17 @@ private:
                 { "Reparsed Statements", metrics.reparsed_statements },
                 { "Continued Statements", metrics.continued_statements },
                 { "Non-continued Statements", metrics.non_continued_statements },
+                { "Using Evaluations", metrics.using_evaluations },
+                { "Using Evaluation Cache Hits", metrics.using_evaluation_cache_hits },
                 { "Lines", metrics.lines },
                 { "Files", files_processed },
+                { "Memory HL Info (B)", metadata.memory.hl_info },
+                { "Memory LSP Context (B)", metadata.memory.lsp_context },
+                { "Memory Diagnostics (B)", metadata.memory.diagnostics },
+                { "Memory Outputs (B)", metadata.memory.outputs },
+                { "Memory Macro Cache (B)", metadata.memory.macro_cache },
+                { "Memory Id Storage (B)", metadata.memory.id_storage },
+                { "Memory Total (B)", metadata.memory.total() },
             }),
             time,
         };
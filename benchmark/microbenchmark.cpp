@@ -0,0 +1,742 @@
+/*
+ * Copyright (c) 2025 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <concepts>
+#include <cstdint>
+#include <format>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#ifdef _MSC_VER
+#    include <intrin.h>
+#endif
+
+#include "analyzer.h"
+#include "context/hlasm_context.h"
+#include "context/id_storage.h"
+#include "context/ordinary_assembly/ordinary_assembly_context.h"
+#include "context/ordinary_assembly/symbol_table.h"
+#include "context/well_known.h"
+#include "diagnostic_consumer.h"
+#include "expressions/evaluation_context.h"
+#include "lexing/logical_line.h"
+#include "lexing/string_with_newlines.h"
+#include "library_info_transitional.h"
+#include "lsp/feature_language_features.h"
+#include "nlohmann/json.hpp"
+#include "parsing/parser_impl.h"
+#include "processing/op_code.h"
+#include "processing/statement_fields_parser.h"
+#include "semantics/operand_impls.h"
+#include "utils/bk_tree.h"
+#include "utils/levenshtein_distance.h"
+#include "utils/memory_usage.h"
+
+/*
+ * The microbenchmark measures isolated kernels of the parser library on generated inputs, so that the results
+ * are reproducible across machines and commits. Kernels prefixed with "analysis." run the complete analysis of
+ * a generated program that stresses a single component. Results are written to stdout as a json document,
+ * progress is reported to stderr.
+ *
+ * Accepted parameters:
+ * -f filter     - Runs only kernels whose name contains the filter (can be repeated)
+ * -t ms         - Minimal measured time per kernel in milliseconds (default 200)
+ * -r count      - Number of measured repetitions per kernel (default 5), the median is reported
+ * -s scale      - Input size multiplier (default 1)
+ * -l            - Lists available kernels and exits
+ *
+ * Reported metrics (per kernel):
+ * - name           - Kernel name
+ * - items          - Number of work items processed by a single kernel invocation
+ * - iterations     - Number of kernel invocations in a single repetition
+ * - median_ns      - Median time of a single kernel invocation
+ * - min_ns         - Fastest repetition, time of a single kernel invocation
+ * - ns_per_item    - median_ns / items
+ * - memory_bytes   - Approximate heap usage of the measured data structure (only reported by some kernels)
+ */
+
+using namespace hlasm_plugin;
+using namespace hlasm_plugin::parser_library;
+
+using json = nlohmann::json;
+
+namespace {
+template<typename... Args>
+void log_i(Args... args)
+{
+    (std::clog << ... << args) << '\n';
+}
+
+template<typename... Args>
+void log_e(Args... args)
+{
+    ((std::clog << "Error: ") << ... << args) << std::endl;
+}
+
+// deterministic across platforms and standard library implementations, unlike std distributions
+class input_generator
+{
+    std::uint64_t m_state;
+
+public:
+    explicit input_generator(std::uint64_t seed = 0x2545F4914F6CDD1DULL)
+        : m_state(seed)
+    {}
+
+    std::uint32_t next() noexcept
+    {
+        m_state ^= m_state << 13;
+        m_state ^= m_state >> 7;
+        m_state ^= m_state << 17;
+        return static_cast<std::uint32_t>(m_state >> 16);
+    }
+
+    size_t below(size_t n) noexcept { return next() % n; }
+
+    std::string name(size_t min_len, size_t max_len)
+    {
+        static constexpr std::string_view first = "ABCDEFGHIJKLMNOPQRSTUVWXYZ@#$";
+        static constexpr std::string_view rest = "ABCDEFGHIJKLMNOPQRSTUVWXYZ@#$_0123456789";
+        std::string result(1, first[below(first.size())]);
+        const auto len = min_len + below(max_len - min_len + 1);
+        while (result.size() < len)
+            result.push_back(rest[below(rest.size())]);
+        return result;
+    }
+};
+
+std::string pad_to(std::string s, size_t column)
+{
+    if (s.size() < column)
+        s.resize(column, ' ');
+    return s;
+}
+
+std::string machine_operands_source(size_t lines)
+{
+    input_generator gen;
+    std::string result = "TEST     CSECT\n         USING TEST,12\n";
+    static constexpr std::string_view instructions[] = {
+        "L     1,FIELD{}",
+        "LA    2,{}(3,4)",
+        "MVC   FIELD{}(8),0(5)",
+        "ST    1,FIELD{}+4",
+        "CLC   FIELD{}(4),=F'{}'",
+        "AHI   6,{}",
+    };
+    for (size_t i = 0; i < lines; ++i)
+    {
+        auto instr = std::string(instructions[gen.below(std::size(instructions))]);
+        while (instr.find("{}") != std::string::npos)
+            instr.replace(instr.find("{}"), 2, std::to_string(gen.below(64)));
+        result.append("         ").append(instr).append("\n");
+    }
+    for (size_t i = 0; i < 64; ++i)
+        result.append(pad_to("FIELD" + std::to_string(i), 9)).append("DS    2F\n");
+    result.append("         END\n");
+    return result;
+}
+
+std::vector<std::string> machine_operands(size_t count)
+{
+    input_generator gen;
+    static constexpr std::string_view operands[] = {
+        "1,FIELD{}",
+        "2,{}(3,4)",
+        "FIELD{}(8),0(5)",
+        "1,FIELD{}+4",
+        "FIELD{}(4),=F'{}'",
+        "6,{}",
+    };
+    std::vector<std::string> result;
+    result.reserve(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        auto op = std::string(operands[gen.below(std::size(operands))]);
+        while (op.find("{}") != std::string::npos)
+            op.replace(op.find("{}"), 2, std::to_string(gen.below(64)));
+        result.push_back(std::move(op));
+    }
+    return result;
+}
+
+std::vector<std::string> dc_operands(size_t count)
+{
+    input_generator gen;
+    static constexpr std::string_view operands[] = {
+        "F'{}'",
+        "2H'{},{}'",
+        "CL8'TEXT{}'",
+        "XL4'{}'",
+        "A(TEST+{})",
+        "PL5'{}'",
+        "AL3({},{}),FL2'{}'",
+    };
+    std::vector<std::string> result;
+    result.reserve(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        auto op = std::string(operands[gen.below(std::size(operands))]);
+        while (op.find("{}") != std::string::npos)
+            op.replace(op.find("{}"), 2, std::to_string(gen.below(1000)));
+        result.push_back(std::move(op));
+    }
+    return result;
+}
+
+// conditional assembly operands paired with the instruction that determines their type
+std::vector<std::pair<context::id_index, std::string>> ca_operands(size_t count, bool with_variables)
+{
+    using wk = context::well_known;
+    static constexpr std::pair<context::id_index, std::string_view> variable_operands[] = {
+        { wk::SETA, "(&A+{})*2/3" },
+        { wk::SETC, "'&C'(1,4).'ABC'.DOUBLE('&C')" },
+        { wk::SETB, "(&A GT &B AND '&C' NE 'X')" },
+    };
+    static constexpr std::pair<context::id_index, std::string_view> constant_operands[] = {
+        { wk::SETA, "(17+X'1F'*3)/2-{}" },
+        { wk::SETA, "{}*(4+B'1011')/7" },
+        { wk::SETB, "({} GT 5 AND 3 LT {})" },
+        { wk::SETB, "(NOT ({} EQ 7) OR 'AB' EQ 'AB')" },
+        { wk::SETC, "'ABC'.'{}'(1,2)" },
+        { wk::SETC, "UPPER('abc{}')" },
+    };
+    std::span<const std::pair<context::id_index, std::string_view>> operands = constant_operands;
+    if (with_variables)
+        operands = variable_operands;
+
+    input_generator gen;
+    std::vector<std::pair<context::id_index, std::string>> result;
+    result.reserve(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        const auto& [instr, text] = operands[gen.below(operands.size())];
+        // operand field including the separating space
+        auto op = " " + std::string(text);
+        while (op.find("{}") != std::string::npos)
+            op.replace(op.find("{}"), 2, std::to_string(gen.below(100)));
+        result.emplace_back(instr, std::move(op));
+    }
+    return result;
+}
+
+std::string continued_lines_source(size_t lines)
+{
+    std::string result;
+    for (size_t i = 0; i < lines; ++i)
+    {
+        result.append(pad_to("         MVC   FIELD(8),OTHER    REMARK TEXT", 71)).append("X\n");
+        result.append(pad_to("               CONTINUED REMARK", 71)).append("X\n");
+        result.append("               LAST LINE\n");
+    }
+    return result;
+}
+
+std::string equ_chain_source(size_t symbols)
+{
+    std::string result;
+    for (size_t i = 0; i < symbols; ++i)
+        result.append(pad_to("S" + std::to_string(i), 9))
+            .append("EQU   S")
+            .append(std::to_string(i + 1))
+            .append("+1\n");
+    result.append(pad_to("S" + std::to_string(symbols), 9)).append("EQU   0\n");
+    return result;
+}
+
+std::string using_source(size_t lines)
+{
+    input_generator gen;
+    std::string result = "TEST     CSECT\n";
+    for (size_t d = 0; d < 8; ++d)
+    {
+        result.append(pad_to("D" + std::to_string(d), 9)).append("DSECT\n");
+        for (size_t f = 0; f < 16; ++f)
+            result.append(pad_to("D" + std::to_string(d) + "F" + std::to_string(f), 9)).append("DS    F\n");
+    }
+    result.append("TEST     CSECT\n");
+    for (size_t d = 0; d < 8; ++d)
+        result.append("         USING D").append(std::to_string(d)).append(",").append(std::to_string(d + 2)).append("\n");
+    for (size_t i = 0; i < lines; ++i)
+        result.append("         L     1,D")
+            .append(std::to_string(gen.below(8)))
+            .append("F")
+            .append(std::to_string(gen.below(16)))
+            .append("\n");
+    result.append("         END\n");
+    return result;
+}
+
+std::vector<std::string> generate_names(size_t count, size_t min_len, size_t max_len)
+{
+    input_generator gen;
+    std::vector<std::string> result;
+    result.reserve(count);
+    for (size_t i = 0; i < count; ++i)
+        result.push_back(gen.name(min_len, max_len));
+    return result;
+}
+
+struct kernel
+{
+    std::string name;
+    size_t items;
+    // prepares the inputs and returns the measured function, only invoked for selected kernels
+    std::function<std::function<void()>()> setup;
+    // optional, approximate heap usage of the data structure the kernel operates on
+    std::function<size_t()> memory = {};
+};
+
+template<typename T>
+void do_not_optimize(const T& value)
+{
+#ifdef _MSC_VER
+    static const volatile T* volatile sink;
+    sink = &value;
+    _ReadWriteBarrier();
+#else
+    asm volatile("" : : "g"(&value) : "memory");
+#endif
+}
+
+std::function<void()> operand_parser_kernel(std::vector<std::string> operands, processing::processing_form form)
+{
+    return [operands = std::move(operands), form, ctx = std::make_shared<context::hlasm_context>()]() {
+        processing::statement_fields_parser parser(*ctx);
+        diagnostic_op_consumer_container diags;
+        size_t parsed = 0;
+        for (const auto& op : operands)
+        {
+            const range r(position(0, 15), position(0, 15 + op.size()));
+            auto result = parser.parse_operand_field(lexing::u8string_view_with_newlines(op),
+                false,
+                semantics::range_provider(r, semantics::adjusting_state::NONE),
+                r.start.column,
+                std::make_pair(processing::processing_format(processing::processing_kind::ORDINARY, form),
+                    processing::op_code()),
+                diags);
+            parsed += result.operands.value.size();
+        }
+        do_not_optimize(parsed);
+    };
+}
+
+processing::processing_status ca_status(context::id_index instr)
+{
+    return {
+        processing::processing_format(processing::processing_kind::ORDINARY, processing::processing_form::CA_GENERIC),
+        processing::op_code(instr, context::instruction_type::CA),
+    };
+}
+
+using symbol_entry = std::variant<context::symbol, context::using_label_tag, context::macro_label_tag>;
+
+// the symbol table layout of ordinary_assembly_context compared with the node based map it replaced
+struct symbol_map_input
+{
+    std::shared_ptr<context::id_storage> ids = std::make_shared<context::id_storage>();
+    std::vector<context::id_index> names;
+    // half of the queries are not defined
+    std::vector<context::id_index> queries;
+
+    explicit symbol_map_input(size_t count)
+    {
+        for (const auto& n : generate_names(count, 1, 24))
+            names.push_back(ids->add(n));
+        for (size_t i = 0; i < count; ++i)
+        {
+            queries.push_back(names[i]);
+            queries.push_back(ids->add("#" + std::to_string(i)));
+        }
+    }
+
+    template<typename Map>
+    void fill(Map& map) const
+    {
+        for (const auto& n : names)
+            map.try_emplace(n,
+                context::symbol(n,
+                    context::symbol_value(),
+                    context::symbol_attributes::make_section_attrs(),
+                    context::processing_stack_t()));
+    }
+};
+
+size_t symbol_map_memory(const std::unordered_map<context::id_index, symbol_entry>& map)
+{
+    return utils::memory_usage::nodes(map);
+}
+
+size_t symbol_map_memory(const context::symbol_table<symbol_entry>& map) { return map.memory_usage(); }
+
+template<typename Map>
+void add_symbol_map_kernels(std::vector<kernel>& result, std::string_view prefix, size_t count)
+{
+    result.push_back({
+        std::format("{}.insert", prefix),
+        count,
+        [count]() -> std::function<void()> {
+            return [input = std::make_shared<symbol_map_input>(count)]() {
+                Map map;
+                input->fill(map);
+                do_not_optimize(map.size());
+            };
+        },
+        [count]() {
+            symbol_map_input input(count);
+            Map map;
+            input.fill(map);
+            return symbol_map_memory(map);
+        },
+    });
+
+    result.push_back({
+        std::format("{}.find", prefix),
+        2 * count,
+        [count]() -> std::function<void()> {
+            auto input = std::make_shared<symbol_map_input>(count);
+            auto map = std::make_shared<Map>();
+            input->fill(*map);
+            return [input, map]() {
+                size_t found = 0;
+                for (const auto& q : input->queries)
+                {
+                    if constexpr (std::same_as<Map, context::symbol_table<symbol_entry>>)
+                        found += map->find(q) != nullptr;
+                    else
+                        found += map->find(q) != map->end();
+                }
+                do_not_optimize(found);
+            };
+        },
+    });
+}
+
+std::vector<kernel> create_kernels(size_t scale)
+{
+    std::vector<kernel> result;
+
+    const auto add_analyzer_kernel = [&result](std::string name, size_t items, std::function<std::string()> source) {
+        result.push_back({
+            std::move(name),
+            items,
+            [source = std::move(source)]() -> std::function<void()> {
+                return [src = source()]() {
+                    analyzer a(src);
+                    a.analyze();
+                    do_not_optimize(a.diags().size());
+                };
+            },
+        });
+    };
+
+    result.push_back({
+        "parser.machine_operands",
+        2000 * scale,
+        [scale]() { return operand_parser_kernel(machine_operands(2000 * scale), processing::processing_form::MACH); },
+    });
+
+    result.push_back({
+        "parser.dc_operands",
+        2000 * scale,
+        [scale]() { return operand_parser_kernel(dc_operands(2000 * scale), processing::processing_form::DAT); },
+    });
+
+    result.push_back({
+        "parser.ca_operands",
+        2000 * scale,
+        [scale]() -> std::function<void()> {
+            return [operands = ca_operands(2000 * scale, true), ctx = std::make_shared<context::hlasm_context>()]() {
+                parsing::parser_holder h(*ctx, nullptr);
+                diagnostic_op_consumer_container diags;
+                size_t parsed = 0;
+                for (const auto& [instr, op] : operands)
+                {
+                    h.prepare_parser(lexing::u8string_view_with_newlines(op),
+                        *ctx,
+                        &diags,
+                        semantics::range_provider(),
+                        range(position(0, 15), position(0, 15 + op.size())),
+                        15,
+                        ca_status(instr));
+                    h.op_rem_body_ca_expr();
+                    parsed += h.collector.current_operands().value.size();
+                }
+                do_not_optimize(parsed);
+            };
+        },
+    });
+
+    result.push_back({
+        "ca_expression.evaluation",
+        5000 * scale,
+        [scale]() -> std::function<void()> {
+            // expressions are parsed once, only their evaluation is measured
+            auto ctx = std::make_shared<context::hlasm_context>();
+            auto expressions = std::make_shared<std::vector<expressions::ca_expr_ptr>>();
+            parsing::parser_holder h(*ctx, nullptr);
+            for (const auto& [instr, op] : ca_operands(5000 * scale, false))
+            {
+                h.prepare_parser(lexing::u8string_view_with_newlines(op),
+                    *ctx,
+                    nullptr,
+                    semantics::range_provider(),
+                    range(position(0, 15), position(0, 15 + op.size())),
+                    15,
+                    ca_status(instr));
+                h.op_rem_body_ca_expr();
+                for (auto& operand : h.collector.current_operands().value)
+                {
+                    if (auto* ca = operand->access_ca(); ca && ca->kind == semantics::ca_kind::EXPR)
+                        expressions->push_back(std::move(ca->access_expr()->expression));
+                }
+            }
+
+            return [ctx, expressions]() {
+                diagnostic_op_consumer_container diags;
+                expressions::evaluation_context eval_ctx { *ctx, library_info_transitional::empty, diags };
+                for (const auto& expr : *expressions)
+                    do_not_optimize(expr->evaluate(eval_ctx));
+            };
+        },
+    });
+
+    // end-to-end workloads, the components depend on the state built by the whole analysis
+    add_analyzer_kernel("analysis.equ_chain", 2000 * scale, [scale]() { return equ_chain_source(2000 * scale); });
+    add_analyzer_kernel("analysis.using_resolution", 2000 * scale, [scale]() { return using_source(2000 * scale); });
+
+    result.push_back({
+        "lexing.extract_logical_line",
+        3000 * scale,
+        [scale]() -> std::function<void()> {
+            return [src = continued_lines_source(1000 * scale)]() {
+                lexing::logical_line<std::string_view::iterator> out;
+                std::string_view input = src;
+                size_t segments = 0;
+                while (true)
+                {
+                    auto [extracted, it] = lexing::extract_logical_line(out, input, lexing::default_ictl);
+                    if (!extracted)
+                        break;
+                    segments += out.segments.size();
+                    input.remove_prefix(std::ranges::distance(input.begin(), it));
+                }
+                do_not_optimize(segments);
+            };
+        },
+    });
+
+    result.push_back({
+        "id_storage.add",
+        20000 * scale,
+        [scale]() -> std::function<void()> {
+            return [names = generate_names(10000 * scale, 4, 24)]() {
+                context::id_storage ids;
+                for (const auto& n : names)
+                    do_not_optimize(ids.add(n));
+                for (const auto& n : names)
+                    do_not_optimize(ids.add(n));
+            };
+        },
+    });
+
+    add_symbol_map_kernels<std::unordered_map<context::id_index, symbol_entry>>(
+        result, "symbols.unordered_map", 50000 * scale);
+    add_symbol_map_kernels<context::symbol_table<symbol_entry>>(result, "symbols.symbol_table", 50000 * scale);
+
+    result.push_back({
+        "levenshtein_distance",
+        10000 * scale,
+        [scale]() -> std::function<void()> {
+            return [names = generate_names(10001 * scale, 1, 8)]() {
+                size_t sum = 0;
+                for (size_t i = 1; i < names.size(); ++i)
+                    sum += utils::levenshtein_distance(names[i - 1], names[i]);
+                do_not_optimize(sum);
+            };
+        },
+    });
+
+    result.push_back({
+        "bk_tree.find",
+        1000 * scale,
+        [scale]() -> std::function<void()> {
+            auto tree = std::make_shared<utils::bk_tree<std::string, utils::levenshtein_distance_t<8>>>();
+            for (const auto& n : generate_names(5000 * scale, 1, 8))
+                tree->insert(n);
+            return [tree, queries = generate_names(1000 * scale, 1, 8)]() {
+                for (const auto& q : queries)
+                    do_not_optimize(tree->find<3>(q, 3));
+            };
+        },
+    });
+
+    result.push_back({
+        "semantic_tokens.encode",
+        2000 * scale,
+        [scale]() -> std::function<void()> {
+            analyzer a(machine_operands_source(2000 * scale), analyzer_options(collect_highlighting_info::yes));
+            a.analyze();
+            return [tokens = a.take_semantic_tokens()]() {
+                do_not_optimize(language_server::lsp::feature_language_features::convert_tokens_to_num_array(tokens));
+            };
+        },
+    });
+
+    return result;
+}
+
+struct measurement
+{
+    size_t iterations;
+    double median_ns;
+    double min_ns;
+};
+
+measurement measure(const std::function<void()>& run, std::chrono::milliseconds min_time, size_t repetitions)
+{
+    using clock = std::chrono::steady_clock;
+
+    // warm-up and calibration
+    size_t iterations = 1;
+    while (true)
+    {
+        const auto start = clock::now();
+        for (size_t i = 0; i < iterations; ++i)
+            run();
+        if (clock::now() - start >= min_time || iterations >= (size_t)1 << 20)
+            break;
+        iterations *= 2;
+    }
+
+    std::vector<double> samples;
+    samples.reserve(repetitions);
+    for (size_t r = 0; r < repetitions; ++r)
+    {
+        const auto start = clock::now();
+        for (size_t i = 0; i < iterations; ++i)
+            run();
+        const std::chrono::duration<double, std::nano> elapsed = clock::now() - start;
+        samples.push_back(elapsed.count() / (double)iterations);
+    }
+    std::ranges::sort(samples);
+
+    return { iterations, samples[samples.size() / 2], samples.front() };
+}
+
+struct microbench_configuration
+{
+    std::vector<std::string> filters;
+    std::chrono::milliseconds min_time { 200 };
+    size_t repetitions = 5;
+    size_t scale = 1;
+    bool list_only = false;
+
+    bool load(int argc, char** argv)
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            const std::string_view arg = argv[i];
+            const auto has_value = i + 1 < argc;
+            try
+            {
+                if (arg == "-f" && has_value)
+                    filters.emplace_back(argv[++i]);
+                else if (arg == "-t" && has_value)
+                    min_time = std::chrono::milliseconds(std::stoul(argv[++i]));
+                else if (arg == "-r" && has_value)
+                    repetitions = std::max<size_t>(1, std::stoul(argv[++i]));
+                else if (arg == "-s" && has_value)
+                    scale = std::max<size_t>(1, std::stoul(argv[++i]));
+                else if (arg == "-l")
+                    list_only = true;
+                else
+                {
+                    log_e("Unknown parameter or missing value ", arg);
+                    return false;
+                }
+            }
+            catch (...)
+            {
+                log_e("Numeric value expected for ", arg);
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool selected(std::string_view name) const
+    {
+        return filters.empty()
+            || std::ranges::any_of(filters, [name](const auto& f) { return name.find(f) != std::string_view::npos; });
+    }
+};
+} // namespace
+
+int main(int argc, char** argv)
+{
+    microbench_configuration cfg;
+    if (!cfg.load(argc, argv))
+        return 1;
+
+    const auto kernels = create_kernels(cfg.scale);
+
+    if (cfg.list_only)
+    {
+        for (const auto& k : kernels)
+            std::cout << k.name << '\n';
+        return 0;
+    }
+
+    json results = json::array();
+    for (const auto& k : kernels)
+    {
+        if (!cfg.selected(k.name))
+            continue;
+
+        log_i("Running ", k.name);
+        const auto m = measure(k.setup(), cfg.min_time, cfg.repetitions);
+        log_i("  ", m.median_ns / 1e6, " ms/iteration, ", m.median_ns / (double)k.items, " ns/item");
+
+        json& r = results.emplace_back(json {
+            { "name", k.name },
+            { "items", k.items },
+            { "iterations", m.iterations },
+            { "median_ns", m.median_ns },
+            { "min_ns", m.min_ns },
+            { "ns_per_item", m.median_ns / (double)k.items },
+        });
+        if (k.memory)
+        {
+            const auto bytes = k.memory();
+            log_i("  ", bytes, " bytes");
+            r["memory_bytes"] = bytes;
+        }
+    }
+
+    std::cout << json({ { "scale", cfg.scale }, { "repetitions", cfg.repetitions }, { "kernels", results } }).dump(2)
+              << '\n';
+
+    return 0;
+}
@@ -0,0 +1,253 @@
+/*
+ * Copyright (c) 2025 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#include "workload_generator.h"
+
+#include <algorithm>
+#include <charconv>
+#include <format>
+#include <fstream>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#include "nlohmann/json.hpp"
+
+namespace hlasm_plugin::benchmark {
+namespace {
+struct parameter_field
+{
+    std::string_view name;
+    size_t workload_parameters::* field;
+};
+
+constexpr parameter_field size_fields[] = {
+    { "programs", &workload_parameters::programs },
+    { "statements", &workload_parameters::statements },
+    { "macros", &workload_parameters::macros },
+    { "macro_depth", &workload_parameters::macro_depth },
+    { "macro_calls", &workload_parameters::macro_calls },
+    { "copy_fanout", &workload_parameters::copy_fanout },
+    { "ca_loop", &workload_parameters::ca_loop },
+    { "forward_refs", &workload_parameters::forward_refs },
+    { "libraries", &workload_parameters::libraries },
+};
+
+// deterministic for a given seed on all platforms
+class generator
+{
+    std::uint64_t m_state;
+
+public:
+    explicit generator(std::uint64_t seed)
+        : m_state(seed ? seed : 1)
+    {}
+
+    size_t below(size_t n) noexcept
+    {
+        m_state ^= m_state << 13;
+        m_state ^= m_state >> 7;
+        m_state ^= m_state << 17;
+        return n ? static_cast<size_t>(m_state >> 16) % n : 0;
+    }
+};
+
+std::string line(std::string_view label, std::string_view instr, std::string_view operands)
+{
+    std::string result(label);
+    result.resize(std::max<size_t>(result.size() + 1, 9), ' ');
+    result.append(instr);
+    result.resize(std::max<size_t>(result.size() + 1, 15), ' ');
+    result.append(operands);
+    result.push_back('\n');
+    return result;
+}
+
+std::string macro_name(size_t i) { return std::format("MAC{:05}", i); }
+std::string copy_name(size_t i) { return std::format("CPY{:05}", i); }
+std::string program_name(size_t i) { return std::format("PGM{:05}.hlasm", i); }
+std::string library_name(size_t i) { return std::format("libs/LIB{:03}", i); }
+
+size_t copy_member_count(const workload_parameters& p) { return p.copy_fanout * 4; }
+
+std::string generate_macro(const workload_parameters& p, size_t i)
+{
+    std::string result;
+    result.append(line("", "MACRO", ""));
+    result.append(line("&L", macro_name(i), "&P"));
+    result.append(line("", "LCLA", "&I"));
+    result.append(line("&I", "SETA", "0"));
+    result.append(line(".LOOP", "ANOP", ""));
+    result.append(line("&I", "SETA", "&I+1"));
+    result.append(line("", "AIF", std::format("(&I LT {}).LOOP", p.ca_loop)));
+    result.append(line("&L", "DS", "F"));
+    result.append(line("", "LA", "1,&P"));
+    // chains of macro_depth nested calls: MAC0 -> MAC1 -> ... -> MAC(depth-1)
+    if (p.macro_depth > 1 && (i % p.macro_depth) != p.macro_depth - 1 && i + 1 < p.macros)
+        result.append(line("", macro_name(i + 1), "&P"));
+    result.append(line("", "MEND", ""));
+    return result;
+}
+
+std::string generate_copy_member(size_t i)
+{
+    std::string result;
+    for (size_t f = 0; f < 8; ++f)
+        result.append(line(std::format("C{:05}F{}", i, f), "DS", f % 2 ? "F" : "CL8"));
+    return result;
+}
+
+std::string generate_program(const workload_parameters& p, size_t i, generator& gen)
+{
+    static constexpr std::string_view ordinary[] = {
+        "1,2",
+        "3,0(4,5)",
+        "6,=F'1'",
+    };
+    static constexpr std::string_view ordinary_instr[] = { "LR", "LA", "L" };
+
+    std::string result;
+    result.append(line(std::format("P{:05}", i), "CSECT", ""));
+    result.append(line("", "USING", "*,12"));
+
+    for (size_t f = 0; f < p.forward_refs; ++f)
+    {
+        result.append(line(std::format("FQ{:05}", f), "EQU", std::format("FQ{:05}+1", f + 1)));
+        result.append(line("", "L", std::format("1,FD{:05}", f)));
+    }
+
+    const auto copies = copy_member_count(p);
+    const auto first_copy = gen.below(copies);
+    for (size_t c = 0; c < p.copy_fanout; ++c)
+        result.append(line("", "COPY", copy_name((first_copy + c) % copies)));
+
+    const auto call_every = p.macro_calls ? std::max<size_t>(1, p.statements / p.macro_calls) : 0;
+    size_t calls = 0;
+    for (size_t s = 0; s < p.statements; ++s)
+    {
+        const auto k = gen.below(std::size(ordinary));
+        result.append(line("", ordinary_instr[k], ordinary[k]));
+        if (p.macros && call_every && s % call_every == 0 && calls < p.macro_calls)
+        {
+            // start at the beginning of a nested chain to exercise the full depth
+            const auto depth = std::max<size_t>(1, p.macro_depth);
+            const auto m = gen.below((p.macros + depth - 1) / depth) * depth;
+            result.append(line(std::format("M{:05}", calls++), macro_name(std::min(m, p.macros - 1)), "0(1)"));
+        }
+    }
+
+    for (size_t f = 0; f < p.forward_refs; ++f)
+        result.append(line(std::format("FD{:05}", f), "DS", "F"));
+    result.append(line(std::format("FQ{:05}", p.forward_refs), "EQU", "4"));
+    result.append(line("", "LTORG", ""));
+    result.append(line("", "END", ""));
+    return result;
+}
+
+bool write_file(const std::filesystem::path& file, const std::string& content)
+{
+    std::error_code ec;
+    std::filesystem::create_directories(file.parent_path(), ec);
+    if (ec)
+        return false;
+
+    std::ofstream out(file, std::ios::binary | std::ios::trunc);
+    out << content;
+    return static_cast<bool>(out);
+}
+} // namespace
+
+std::optional<workload_parameters> workload_parameters::parse(std::string_view spec)
+{
+    workload_parameters result;
+    while (!spec.empty())
+    {
+        const auto item = spec.substr(0, spec.find(','));
+        spec.remove_prefix(std::min(spec.size(), item.size() + 1));
+        if (item.empty())
+            continue;
+
+        const auto eq = item.find('=');
+        if (eq == std::string_view::npos)
+            return std::nullopt;
+        const auto key = item.substr(0, eq);
+        const auto value = item.substr(eq + 1);
+
+        std::uint64_t v = 0;
+        if (auto [p, ec] = std::from_chars(value.data(), value.data() + value.size(), v);
+            ec != std::errc() || p != value.data() + value.size())
+            return std::nullopt;
+
+        if (key == "seed")
+        {
+            result.seed = v;
+            continue;
+        }
+
+        const auto f = std::ranges::find(size_fields, key, &parameter_field::name);
+        if (f == std::ranges::end(size_fields))
+            return std::nullopt;
+        result.*(f->field) = static_cast<size_t>(v);
+    }
+    result.libraries = std::max<size_t>(1, result.libraries);
+    return result;
+}
+
+std::string workload_parameters::to_string() const
+{
+    std::string result;
+    for (const auto& [name, field] : size_fields)
+        result.append(name).append("=").append(std::to_string(this->*field)).append(",");
+    result.append("seed=").append(std::to_string(seed));
+    return result;
+}
+
+bool generate_workload(const workload_parameters& params, const std::filesystem::path& dir)
+{
+    using json = nlohmann::json;
+
+    generator gen(params.seed);
+
+    for (size_t m = 0; m < params.macros; ++m)
+    {
+        const auto lib = library_name(m % params.libraries);
+        if (!write_file(dir / lib / macro_name(m), generate_macro(params, m)))
+            return false;
+    }
+
+    for (size_t c = 0; c < copy_member_count(params); ++c)
+    {
+        const auto lib = library_name(c % params.libraries);
+        if (!write_file(dir / lib / copy_name(c), generate_copy_member(c)))
+            return false;
+    }
+
+    json pgms = json::array();
+    for (size_t p = 0; p < params.programs; ++p)
+    {
+        if (!write_file(dir / program_name(p), generate_program(params, p, gen)))
+            return false;
+        pgms.push_back({ { "program", program_name(p) }, { "pgroup", "GENERATED" } });
+    }
+
+    json libs = json::array();
+    for (size_t l = 0; l < params.libraries; ++l)
+        libs.push_back(library_name(l));
+
+    return write_file(dir / ".hlasmplugin" / "pgm_conf.json", json({ { "pgms", pgms } }).dump(2))
+        && write_file(dir / ".hlasmplugin" / "proc_grps.json",
+            json({ { "pgroups", json::array({ { { "name", "GENERATED" }, { "libs", libs } } }) } }).dump(2));
+}
+
+} // namespace hlasm_plugin::benchmark
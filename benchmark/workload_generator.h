@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2025 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#ifndef HLASMPLUGIN_BENCHMARK_WORKLOAD_GENERATOR_H
+#define HLASMPLUGIN_BENCHMARK_WORKLOAD_GENERATOR_H
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace hlasm_plugin::benchmark {
+
+// parameters of a synthetic HLASM workspace
+struct workload_parameters
+{
+    size_t programs = 10; // number of open code programs
+    size_t statements = 500; // ordinary statements per program
+    size_t macros = 50; // number of macros spread across libraries
+    size_t macro_depth = 3; // length of nested macro call chains
+    size_t macro_calls = 20; // macro calls per program
+    size_t copy_fanout = 2; // COPY members included by each program
+    size_t ca_loop = 10; // iterations of the conditional assembly loop in each macro
+    size_t forward_refs = 100; // forward referenced symbols per program
+    size_t libraries = 2; // number of library directories
+    std::uint64_t seed = 1;
+
+    // parses comma separated key=value pairs, e.g. "programs=100,macro_depth=5"
+    static std::optional<workload_parameters> parse(std::string_view spec);
+
+    std::string to_string() const;
+};
+
+// writes programs, libraries and .hlasmplugin configuration into the directory
+bool generate_workload(const workload_parameters& params, const std::filesystem::path& dir);
+
+} // namespace hlasm_plugin::benchmark
+
+#endif
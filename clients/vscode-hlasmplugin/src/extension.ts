@@ -66,7 +66,8 @@ function objectToString(o: any) {
 const getCacheInfo = async (uri: vscode.Uri, fs: vscode.FileSystem) => {
     try {
         await fs.createDirectory(uri);
-        return { uri, fs };
+        const limitMB = vscode.workspace.getConfiguration('hlasm').get<number>('externalFilesCacheSizeLimit', 512);
+        return { uri, fs, sizeLimit: limitMB > 0 ? limitMB * 1024 * 1024 : undefined };
     }
     catch (e) {
         vscode.window.showErrorMessage('Unable to create cache directory for external resources', ...(e instanceof Error ? [e.message] : []));
@@ -121,6 +122,7 @@ export async function activate(context: vscode.ExtensionContext): Promise<HlasmE
         await getCacheInfo(vscode.Uri.joinPath(context.globalStorageUri, 'external.files.cache'), vscode.workspace.fs)
     );
     context.subscriptions.push(extFiles);
+    extFiles.trimCache().catch(() => { });
 
     const hlasmpluginClient = await startLanguageServerWithFallback({
         version, serverVariant, pseudoCharset, clientOptions, context, telemetry, clientErrorHandler, middleware, extConfProvider, extFiles,
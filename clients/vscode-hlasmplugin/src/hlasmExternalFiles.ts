@@ -33,6 +33,7 @@ function getEncodingExtras() {
 export const enum ExternalRequestType {
     read_file = 'read_file',
     list_directory = 'list_directory',
+    read_files = 'read_files',
 }
 
 interface ExternalRequest {
@@ -48,6 +49,11 @@ interface ExternalReadFileResponse {
     data: string,
 }
 
+interface ExternalReadFilesResponse {
+    id: number,
+    data: (string | Omit<ExternalErrorResponse, 'id'>)[],
+}
+
 interface ExternalListDirectoryResponse {
     id: number,
     data: {
@@ -184,10 +190,13 @@ export class HLASMExternalFiles {
 
     private channel?: ChannelType = undefined;
 
+    private cacheSizeEstimate = 0;
+    private pendingCacheTrim?: Promise<void> = undefined;
+
     constructor(
         private magicScheme: string,
         private fs: vscode.FileSystem,
-        private cache?: { uri: vscode.Uri }) {
+        private cache?: { uri: vscode.Uri, sizeLimit?: number }) {
     }
 
     public attach(channel: {
@@ -489,7 +498,11 @@ export class HLASMExternalFiles {
                     data: value,
                 }));
 
-            await this.fs.writeFile(cacheEntryName, await deflate(data));
+            const deflated = await deflate(data);
+            await this.fs.writeFile(cacheEntryName, deflated);
+            this.cacheSizeEstimate += deflated.length;
+            if (this.cache.sizeLimit !== undefined && this.cacheSizeEstimate > this.cache.sizeLimit)
+                this.scheduleCacheTrim();
             return true;
         }
         catch (e) { }
@@ -651,10 +664,32 @@ export class HLASMExternalFiles {
         });
     }
 
-    public async handleRawMessage(msg: any): Promise<ExternalReadFileResponse | ExternalListDirectoryResponse | ExternalErrorResponse | null> {
+    private async handleReadFilesMessage(msg: { id: number, urls: string[] }): Promise<ExternalReadFilesResponse> {
+        const data = await Promise.all(msg.urls.map(async url => {
+            try {
+                const response = await this.handleFileMessage(vscode.Uri.parse(url, true), { id: msg.id, op: ExternalRequestType.read_file, url });
+                if (!response)
+                    return { error: { code: -1000, msg: 'No response' } };
+                return 'data' in response ? response.data : { error: response.error };
+            }
+            catch (e) {
+                return { error: { code: -5, msg: 'Invalid request' } };
+            }
+        }));
+
+        return { id: msg.id, data };
+    }
+
+    public async handleRawMessage(msg: any): Promise<ExternalReadFileResponse | ExternalReadFilesResponse | ExternalListDirectoryResponse | ExternalErrorResponse | null> {
         if (!msg || typeof msg.id !== 'number' || typeof msg.op !== 'string')
             return null;
 
+        if (msg.op === ExternalRequestType.read_files) {
+            if (!Array.isArray(msg.urls) || !msg.urls.every((x: unknown) => typeof x === 'string'))
+                return this.generateError(msg.id, -5, 'Invalid request');
+            return this.handleReadFilesMessage(msg);
+        }
+
         if (typeof msg.url !== 'string')
             return this.generateError(msg.id, -5, 'Invalid request');
 
@@ -710,6 +745,50 @@ export class HLASMExternalFiles {
         this.clearMemoryCache(service);
     }
 
+    private scheduleCacheTrim() {
+        if (this.pendingCacheTrim) return;
+        this.pendingCacheTrim = this.trimCache().then(() => { }, () => { }).finally(() => { this.pendingCacheTrim = undefined; });
+    }
+
+    // Removes the oldest cache entries until the cache fits into the size limit, entries of other cache versions are always removed
+    public async trimCache() {
+        if (!this.cache) return 0;
+        const { uri, sizeLimit } = this.cache;
+
+        const entries: { file: vscode.Uri, size: number, mtime: number }[] = [];
+        const obsolete: vscode.Uri[] = [];
+        for (const [filename, type] of await this.fs.readDirectory(uri)) {
+            if ((type & vscode.FileType.File) !== vscode.FileType.File)
+                continue;
+            const file = vscode.Uri.joinPath(uri, filename);
+            if (!filename.startsWith(cacheVersion + '.'))
+                obsolete.push(file);
+            else {
+                try {
+                    const { size, mtime } = await this.fs.stat(file);
+                    entries.push({ file, size, mtime });
+                }
+                catch (e) { }
+            }
+        }
+
+        let total = entries.reduce((acc, e) => acc + e.size, 0);
+        if (sizeLimit !== undefined && total > sizeLimit) {
+            entries.sort((l, r) => l.mtime - r.mtime);
+            for (const e of entries) {
+                if (total <= sizeLimit)
+                    break;
+                obsolete.push(e.file);
+                total -= e.size;
+            }
+        }
+
+        await Promise.allSettled(obsolete.map(x => this.fs.delete(x)));
+
+        this.cacheSizeEstimate = total;
+        return total;
+    }
+
     private clearMemoryCache(service: string | undefined) {
         if (!service) {
             this.memberContent.clear();
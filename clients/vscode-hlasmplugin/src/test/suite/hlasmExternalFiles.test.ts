@@ -46,6 +46,12 @@ suite('External files', () => {
 
         assert.deepStrictEqual(await ext.handleRawMessage({ id: 5, op: 'read_file', url: 'test:/SERVICE' }), { id: 5, error: { code: -1000, msg: 'No client' } });
 
+        assert.deepStrictEqual(await ext.handleRawMessage({ id: 5, op: 'read_files', urls: 5 }), { id: 5, error: { code: -5, msg: 'Invalid request' } });
+        assert.deepStrictEqual(await ext.handleRawMessage({ id: 5, op: 'read_files', urls: [5] }), { id: 5, error: { code: -5, msg: 'Invalid request' } });
+        assert.deepStrictEqual(await ext.handleRawMessage({ id: 5, op: 'read_files', urls: ['unknown:scheme', 'test:/SERVICE'] }), {
+            id: 5, data: [{ error: { code: -1000, msg: 'not found' } }, { error: { code: -1000, msg: 'No client' } }]
+        });
+
         attached.dispose();
     });
 
@@ -235,6 +241,34 @@ suite('External files', () => {
         attached.dispose();
     });
 
+    test('Cache size limit', async () => {
+        const cacheUri = Uri.parse('test:cache/');
+
+        const deleted: string[] = [];
+        const mtimes = new Map([['v3.TEST.OLD', 1], ['v3.TEST.MID', 2], ['v3.TEST.NEW', 3]]);
+
+        const ext = new HLASMExternalFiles('test', {
+            readDirectory: async (uri: Uri) => {
+                assert.strictEqual(cacheUri.toString(), uri.toString());
+                return [['v3.TEST.OLD', FileType.File], ['v3.TEST.NEW', FileType.File], ['v3.TEST.MID', FileType.File], ['v2.TEST.A', FileType.File]];
+            },
+            stat: async (uri: Uri) => {
+                const mtime = mtimes.get(uri.path.split('/').pop()!);
+                assert.ok(mtime);
+                return { type: FileType.File, ctime: 0, mtime, size: 40 };
+            },
+            delete: async (uri: Uri) => {
+                deleted.push(uri.path.split('/').pop()!);
+            },
+        } as any as FileSystem, {
+            uri: cacheUri,
+            sizeLimit: 100,
+        });
+
+        assert.strictEqual(await ext.trimCache(), 80);
+        assert.deepStrictEqual(deleted.sort(), ['v2.TEST.A', 'v3.TEST.OLD']);
+    });
+
     test('Selective cache clear', async () => {
         const cacheUri = Uri.parse('test:cache/');
 
@@ -106,6 +106,9 @@ void dap_feature::register_methods(std::map<std::string, method>& methods)
     add_method("variables", &dap_feature::on_variables);
     add_method("continue", &dap_feature::on_continue, LOG_EVENT);
     add_method("pause", &dap_feature::on_pause, LOG_EVENT);
+    add_method("restart", &dap_feature::on_restart, LOG_EVENT);
+    add_method("stepBack", &dap_feature::on_step_back, LOG_EVENT);
+    add_method("reverseContinue", &dap_feature::on_reverse_continue, LOG_EVENT);
     add_method("evaluate", &dap_feature::on_evaluate, LOG_EVENT);
 }
 nlohmann::json dap_feature::register_capabilities() { return nlohmann::json(); }
@@ -160,6 +163,8 @@ void dap_feature::on_initialize(const request_id& requested_seq, const nlohmann:
             { "supportsConfigurationDoneRequest", true },
             { "supportsEvaluateForHovers", true },
             { "supportsFunctionBreakpoints", true },
+            { "supportsRestartRequest", true },
+            { "supportsStepBack", true },
         });
 
     line_1_based_ = args.at("linesStartAt1").get<bool>() ? 1 : 0;
@@ -457,6 +462,36 @@ void dap_feature::on_pause(const request_id& request_seq, const nlohmann::json&)
     response_->respond(request_seq, "pause", nlohmann::json());
 }
 
+void dap_feature::on_restart(const request_id& request_seq, const nlohmann::json&)
+{
+    if (!debugger)
+        return;
+
+    debugger->restart();
+
+    response_->respond(request_seq, "restart", nlohmann::json());
+}
+
+void dap_feature::on_step_back(const request_id& request_seq, const nlohmann::json&)
+{
+    if (!debugger)
+        return;
+
+    debugger->step_back();
+
+    response_->respond(request_seq, "stepBack", nlohmann::json());
+}
+
+void dap_feature::on_reverse_continue(const request_id& request_seq, const nlohmann::json&)
+{
+    if (!debugger)
+        return;
+
+    debugger->reverse_continue();
+
+    response_->respond(request_seq, "reverseContinue", nlohmann::json());
+}
+
 void dap_feature::on_evaluate(const request_id& request_seq, const nlohmann::json& args)
 {
     if (!debugger)
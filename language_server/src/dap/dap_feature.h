@@ -70,6 +70,9 @@ public:
     void on_variables(const request_id& request_seq, const nlohmann::json& args);
     void on_continue(const request_id& request_seq, const nlohmann::json& args);
     void on_pause(const request_id& request_seq, const nlohmann::json& args);
+    void on_restart(const request_id& request_seq, const nlohmann::json& args);
+    void on_step_back(const request_id& request_seq, const nlohmann::json& args);
+    void on_reverse_continue(const request_id& request_seq, const nlohmann::json& args);
     void on_evaluate(const request_id& request_seq, const nlohmann::json& args);
 
     void idle_handler(const std::atomic<unsigned char>* yield_indicator);
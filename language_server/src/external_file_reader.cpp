@@ -86,6 +86,59 @@ void external_file_reader::read_external_file(
         content.error(utils::error::message_send);
 }
 
+void external_file_reader::read_external_files(
+    std::span<const std::string_view> urls, std::span<const workspace_manager_response<std::string_view>> contents)
+{
+    assert(urls.size() == contents.size());
+
+    if (urls.empty())
+        return;
+
+    auto next_id = m_next_id.fetch_add(1, std::memory_order_relaxed);
+    nlohmann::json msg = {
+        { "id", next_id },
+        { "op", "read_files" },
+        { "urls", urls },
+    };
+
+    std::function handler = [contents = std::vector(contents.begin(), contents.end())](
+                                bool error, const nlohmann::json& result) noexcept {
+        if (error)
+        {
+            auto [err, errmsg] = extract_error(result);
+            for (const auto& content : contents)
+                content.error(err, errmsg);
+        }
+        else if (!result.is_array() || result.size() != contents.size())
+        {
+            for (const auto& content : contents)
+                content.error(utils::error::invalid_json);
+        }
+        else
+        {
+            for (size_t i = 0; i < contents.size(); ++i)
+            {
+                const auto& item = result[i];
+                if (item.is_string())
+                    contents[i].provide(item.get<std::string_view>());
+                else if (const auto e = item.find("error"); item.is_object() && e != item.end())
+                {
+                    auto [err, errmsg] = extract_error(*e);
+                    contents[i].error(err, errmsg);
+                }
+                else
+                    contents[i].error(utils::error::invalid_json);
+            }
+        }
+    };
+
+    if (!enqueue_message(next_id, std::move(msg), std::move(handler)))
+    {
+        for (const auto& content : contents)
+            content.error(utils::error::message_send);
+    }
+}
+
 void external_file_reader::read_external_directory(
     std::string_view url, workspace_manager_response<workspace_manager_external_directory_result> members, bool subdir)
 {
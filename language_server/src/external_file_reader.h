@@ -18,6 +18,7 @@
 #include <atomic>
 #include <functional>
 #include <mutex>
+#include <span>
 #include <thread>
 #include <unordered_map>
 #include <utility>
@@ -54,6 +55,8 @@ public:
     // Inherited via workspace_manager_external_file_requests
     void read_external_file(
         std::string_view url, parser_library::workspace_manager_response<std::string_view> content) override;
+    void read_external_files(std::span<const std::string_view> urls,
+        std::span<const parser_library::workspace_manager_response<std::string_view>> contents) override;
     void read_external_directory(std::string_view url,
         parser_library::workspace_manager_response<parser_library::workspace_manager_external_directory_result> members,
         bool subdir = false) override;
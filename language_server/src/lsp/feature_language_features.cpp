@@ -24,6 +24,7 @@
 #include "document_symbol_item.h"
 #include "location.h"
 #include "nlohmann/json.hpp"
+#include "parsing_metadata_serialization.h"
 #include "utils/error_codes.h"
 #include "utils/resource_location.h"
 #include "utils/text_convertor.h"
@@ -50,6 +51,12 @@ void to_json(nlohmann::json& j, const output_line& ol)
     j["level"] = ol.level;
     j["text"] = ol.text;
 }
+
+void to_json(nlohmann::json& j, const file_memory_usage& fmu)
+{
+    j["uri"] = fmu.document_uri;
+    j["memory"] = fmu.memory;
+}
 } // namespace hlasm_plugin::parser_library
 
 namespace hlasm_plugin::language_server::lsp {
@@ -250,6 +257,7 @@ void feature_language_features::register_methods(std::map<std::string, method>&
     add_method("textDocument/$/branch_information", &feature_language_features::branch_information);
     add_method("textDocument/foldingRange", &feature_language_features::folding);
     add_method("textDocument/$/retrieve_outputs", &feature_language_features::retrieve_outputs);
+    add_method("$/memory_usage", &feature_language_features::memory_usage);
 }
 
 nlohmann::json feature_language_features::register_capabilities()
@@ -852,4 +860,14 @@ void feature_language_features::retrieve_outputs(const request_id& id, const nlo
     response_->register_cancellable_request(id, std::move(resp));
 }
 
+void feature_language_features::memory_usage(const request_id& id, const nlohmann::json&)
+{
+    auto resp = make_response(
+        id, response_, [](std::span<const file_memory_usage> usage) { return nlohmann::json(usage); });
+
+    ws_mngr_.memory_usage(resp);
+
+    response_->register_cancellable_request(id, std::move(resp));
+}
+
 } // namespace hlasm_plugin::language_server::lsp
@@ -40,15 +40,31 @@ void to_json(nlohmann::json& j, const parser_library::performance_metrics& metri
         { "Reparsed Statements", metrics.reparsed_statements },
         { "Continued Statements", metrics.continued_statements },
         { "Non-continued Statements", metrics.non_continued_statements },
+        { "Using Evaluations", metrics.using_evaluations },
+        { "Using Evaluation Cache Hits", metrics.using_evaluation_cache_hits },
         { "Lines", metrics.lines },
     };
 }
 
+void to_json(nlohmann::json& j, const parser_library::memory_metrics& memory)
+{
+    j = nlohmann::json {
+        { "hl_info", memory.hl_info },
+        { "lsp_context", memory.lsp_context },
+        { "diagnostics", memory.diagnostics },
+        { "outputs", memory.outputs },
+        { "macro_cache", memory.macro_cache },
+        { "id_storage", memory.id_storage },
+        { "total", memory.total() },
+    };
+}
+
 void to_json(nlohmann::json& j, const parser_library::parsing_metadata& metadata)
 {
     j = nlohmann::json { { "properties", metadata.ws_info }, { "measurements", metadata.metrics } };
     j["measurements"]["error_count"] = metadata.errors;
     j["measurements"]["warning_count"] = metadata.warnings;
+    j["measurements"]["memory_usage"] = metadata.memory.total();
 }
 
 } // namespace hlasm_plugin::parser_library
@@ -22,6 +22,8 @@ void to_json(nlohmann::json& j, const parser_library::workspace_file_info& info)
 
 void to_json(nlohmann::json& j, const parser_library::performance_metrics& metrics);
 
+void to_json(nlohmann::json& j, const parser_library::memory_metrics& memory);
+
 void to_json(nlohmann::json& j, const parser_library::parsing_metadata& metadata);
 
 } // namespace hlasm_plugin::parser_library
@@ -304,6 +304,44 @@ TEST_F(feature_launch_test, step)
     feature.on_disconnect(request_id(48), {});
 }
 
+TEST_F(feature_launch_test, step_back_and_restart)
+{
+    ws_mngr->did_open_file(utils::path::path_to_uri(file_path), 0, file_step);
+    ws_mngr->idle_handler();
+
+    feature.on_launch(request_id(0), nlohmann::json { { "program", file_path }, { "stopOnEntry", true } });
+    ws_mngr->idle_handler();
+    wait_for_stopped();
+    resp_provider.reset();
+
+    feature.on_step_in(request_id(1), nlohmann::json());
+    wait_for_stopped();
+    resp_provider.reset();
+    check_simple_stack_trace(request_id(2), 1);
+
+    feature.on_step_back(request_id(3), nlohmann::json());
+    std::vector<response_mock> expected_resp = { { request_id(3), "stepBack", nlohmann::json() } };
+    EXPECT_EQ(resp_provider.responses, expected_resp);
+    ws_mngr->idle_handler();
+    wait_for_stopped();
+    resp_provider.reset();
+    check_simple_stack_trace(request_id(4), 0);
+
+    feature.on_next(request_id(5), nlohmann::json());
+    wait_for_stopped();
+    resp_provider.reset();
+
+    feature.on_restart(request_id(6), nlohmann::json());
+    expected_resp = { { request_id(6), "restart", nlohmann::json() } };
+    EXPECT_EQ(resp_provider.responses, expected_resp);
+    ws_mngr->idle_handler();
+    wait_for_stopped();
+    resp_provider.reset();
+    check_simple_stack_trace(request_id(7), 0);
+
+    feature.on_disconnect(request_id(8), {});
+}
+
 const std::string file_breakpoint = R"(  LR 1,1
   LR 1,1  First breakpoint comes on this line
 
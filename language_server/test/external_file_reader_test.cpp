@@ -159,6 +159,83 @@ TEST(external_file_reader, file_reading_error)
 })"_json);
 }
 
+TEST(external_file_reader, files_reading)
+{
+    NiceMock<mock_json_sink> sink;
+    MockFunction<void()> wakeup;
+
+    auto [r1, resp1] = make_workspace_manager_response(
+        std::in_place_type<NiceMock<workspace_manager_response_mock<std::string_view>>>);
+    auto [r2, resp2] = make_workspace_manager_response(
+        std::in_place_type<NiceMock<workspace_manager_response_mock<std::string_view>>>);
+    external_file_reader reader(sink);
+
+    auto reg = reader.register_thread(wakeup.AsStdFunction());
+
+    EXPECT_CALL(sink,
+        write_rvr(
+            R"(
+{
+  "jsonrpc": "2.0",
+  "method":"external_file_request",
+  "params":{
+    "id":1,
+    "op":"read_files",
+    "urls":["AAA","BBB"]
+  }
+})"_json));
+
+    const std::string_view urls[] = { "AAA", "BBB" };
+    const workspace_manager_response<std::string_view> responses[] = { r1, r2 };
+    reader.read_external_files(urls, responses);
+
+    EXPECT_CALL(*resp1, provide(Truly([](std::string_view v) { return v == "AAACONTENT"; })));
+    EXPECT_CALL(*resp2, error(1, StrEq("Error")));
+    EXPECT_CALL(wakeup, Call());
+
+    reader.write(R"(
+{
+  "jsonrpc": "2.0",
+  "method":"external_file_response",
+  "params":{
+    "id":1,
+    "data":["AAACONTENT",{"error":{"code":1,"msg":"Error"}}]
+  }
+})"_json);
+}
+
+TEST(external_file_reader, files_reading_bad)
+{
+    NiceMock<mock_json_sink> sink;
+    MockFunction<void()> wakeup;
+
+    auto [r1, resp1] = make_workspace_manager_response(
+        std::in_place_type<NiceMock<workspace_manager_response_mock<std::string_view>>>);
+    auto [r2, resp2] = make_workspace_manager_response(
+        std::in_place_type<NiceMock<workspace_manager_response_mock<std::string_view>>>);
+    external_file_reader reader(sink);
+
+    auto reg = reader.register_thread(wakeup.AsStdFunction());
+
+    const std::string_view urls[] = { "AAA", "BBB" };
+    const workspace_manager_response<std::string_view> responses[] = { r1, r2 };
+    reader.read_external_files(urls, responses);
+
+    EXPECT_CALL(*resp1, error(_, _));
+    EXPECT_CALL(*resp2, error(_, _));
+    EXPECT_CALL(wakeup, Call());
+
+    reader.write(R"(
+{
+  "jsonrpc": "2.0",
+  "method":"external_file_response",
+  "params":{
+    "id":1,
+    "data":["AAACONTENT"]
+  }
+})"_json);
+}
+
 TEST(external_file_reader, directory_reading)
 {
     NiceMock<mock_json_sink> sink;
@@ -543,3 +543,54 @@ TEST(language_features, retrieve_output_empty)
 
     ws_mngr->idle_handler();
 }
+
+TEST(language_features, memory_usage)
+{
+    test::ws_mngr_mock ws_mngr;
+    NiceMock<response_provider_mock> response_mock;
+    lsp::feature_language_features f(ws_mngr, response_mock, nullptr);
+    std::map<std::string, method> notifs;
+    f.register_methods(notifs);
+
+    using namespace hlasm_plugin::parser_library;
+
+    EXPECT_CALL(ws_mngr, memory_usage(_)).WillOnce(Invoke([](auto channel) {
+        const file_memory_usage usage[] = {
+            { uri, { .hl_info = 1, .lsp_context = 2, .diagnostics = 3, .outputs = 4, .macro_cache = 5, .id_storage = 6 } },
+            { uri + "2", {} },
+        };
+        channel.provide(usage);
+    }));
+
+    auto expected_json = nlohmann::json::parse(R"(
+[
+  {
+    "uri": ")" + uri + R"(",
+    "memory": {
+      "hl_info": 1,
+      "lsp_context": 2,
+      "diagnostics": 3,
+      "outputs": 4,
+      "macro_cache": 5,
+      "id_storage": 6,
+      "total": 21
+    }
+  },
+  {
+    "uri": ")" + uri + R"(2",
+    "memory": {
+      "hl_info": 0,
+      "lsp_context": 0,
+      "diagnostics": 0,
+      "outputs": 0,
+      "macro_cache": 0,
+      "id_storage": 0,
+      "total": 0
+    }
+  }
+]
+)");
+    EXPECT_CALL(response_mock, respond(request_id(0), std::string(""), std::move(expected_json)));
+
+    notifs["$/memory_usage"].as_request_handler()(request_id(0), nlohmann::json::object());
+}
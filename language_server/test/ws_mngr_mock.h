@@ -113,6 +113,8 @@ public:
         (override));
 
     MOCK_METHOD(void, change_implicit_group_base, (std::string_view uri), (override));
+
+    MOCK_METHOD(void, memory_usage, (workspace_manager_response<std::span<const file_memory_usage>> resp), (override));
 };
 
 } // namespace hlasm_plugin::language_server::test
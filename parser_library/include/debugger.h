@@ -65,6 +65,11 @@ public:
     void disconnect();
     void continue_debug();
     void pause();
+    // Replays the analysis from the start, stop on entry is honored.
+    void restart();
+    // Replays the analysis up to the previous executed statement or the previous breakpoint hit.
+    void step_back();
+    void reverse_continue();
 
     void breakpoints(std::string_view source, std::span<const breakpoint> bps);
     [[nodiscard]] std::span<const breakpoint> breakpoints(std::string_view source) const;
@@ -92,10 +92,36 @@ struct performance_metrics
     size_t lookahead_statements = 0;
     size_t continued_statements = 0;
     size_t non_continued_statements = 0;
+    size_t using_evaluations = 0;
+    size_t using_evaluation_cache_hits = 0;
 
     bool operator==(const performance_metrics&) const noexcept = default;
 };
 
+// approximate number of bytes held by structures related to an analyzed file
+// macro_cache counts every cached statement at a flat estimate of 512 bytes, statements are polymorphic
+struct memory_metrics
+{
+    size_t hl_info = 0;
+    size_t lsp_context = 0;
+    size_t diagnostics = 0;
+    size_t outputs = 0;
+    size_t macro_cache = 0;
+    size_t id_storage = 0;
+
+    size_t total() const noexcept { return hl_info + lsp_context + diagnostics + outputs + macro_cache + id_storage; }
+
+    bool operator==(const memory_metrics&) const noexcept = default;
+};
+
+struct file_memory_usage
+{
+    std::string document_uri;
+    memory_metrics memory;
+
+    bool operator==(const file_memory_usage&) const noexcept = default;
+};
+
 struct workspace_file_info
 {
     size_t files_processed = 0;
@@ -110,6 +136,7 @@ struct parsing_metadata
     workspace_file_info ws_info;
     size_t errors = 0;
     size_t warnings = 0;
+    memory_metrics memory;
 };
 
 struct token_info
@@ -183,6 +183,8 @@ public:
         std::string_view document_uri, workspace_manager_response<std::span<const output_line>> resp) = 0;
 
     virtual void change_implicit_group_base(std::string_view uri) = 0;
+
+    virtual void memory_usage(workspace_manager_response<std::span<const file_memory_usage>> resp) = 0;
 };
 
 struct workspace_manager_args
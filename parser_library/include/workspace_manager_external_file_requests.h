@@ -34,6 +34,13 @@ protected:
 
 public:
     virtual void read_external_file(std::string_view url, workspace_manager_response<std::string_view> content) = 0;
+    // Requests several files at once, contents[i] receives the content of urls[i].
+    virtual void read_external_files(
+        std::span<const std::string_view> urls, std::span<const workspace_manager_response<std::string_view>> contents)
+    {
+        for (size_t i = 0; i < urls.size(); ++i)
+            read_external_file(urls[i], contents[i]);
+    }
     virtual void read_external_directory(std::string_view url,
         workspace_manager_response<workspace_manager_external_directory_result> members,
         bool subdir = false) = 0;
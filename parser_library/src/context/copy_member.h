@@ -39,6 +39,15 @@ struct copy_member
         , cached_definition(std::make_move_iterator(definition.begin()), std::make_move_iterator(definition.end()))
         , definition_location(std::move(definition_location))
     {}
+
+    // approximate number of bytes held by the member
+    size_t memory_usage() const noexcept
+    {
+        size_t result = sizeof(*this) + cached_definition.capacity() * sizeof(statement_cache);
+        for (const auto& stmt : cached_definition)
+            result += stmt.memory_usage() - sizeof(stmt);
+        return result;
+    }
 };
 
 using copy_member_ptr = std::shared_ptr<copy_member>;
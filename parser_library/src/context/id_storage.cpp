@@ -16,6 +16,7 @@
 
 #include <memory>
 
+#include "utils/memory_usage.h"
 #include "utils/string_operations.h"
 
 using namespace hlasm_plugin::parser_library::context;
@@ -27,21 +28,46 @@ id_index id_storage::small_id(std::string_view value)
     return id_index(std::string_view(buf, end - buf));
 }
 
-size_t id_storage::size() const { return lit_.size(); }
+id_storage::id_storage(std::shared_ptr<const id_storage> base)
+    : base_(std::move(base))
+{}
 
-bool id_storage::empty() const { return lit_.empty(); }
+size_t id_storage::size() const { return lit_.size() + (base_ ? base_->size() : 0); }
 
-std::optional<id_index> id_storage::find(std::string_view value) const
+bool id_storage::empty() const { return lit_.empty() && (!base_ || base_->empty()); }
+
+size_t id_storage::memory_usage() const
 {
-    if (value.size() < id_index::buffer_size)
-        return small_id(value);
+    size_t result = sizeof(*this) + utils::memory_usage::nodes(lit_);
+    for (const auto& s : lit_)
+        result += utils::memory_usage::heap(s);
+    if (base_)
+        result += base_->memory_usage();
+    return result;
+}
+
+std::optional<id_index> id_storage::find_upper(const std::string& value) const
+{
+    if (base_)
+    {
+        if (auto result = base_->find_upper(value))
+            return result;
+    }
 
-    if (auto tmp = lit_.find(utils::to_upper_copy(std::string(value))); tmp != lit_.end())
+    if (auto tmp = lit_.find(value); tmp != lit_.end())
         return id_index(std::to_address(tmp));
     else
         return std::nullopt;
 }
 
+std::optional<id_index> id_storage::find(std::string_view value) const
+{
+    if (value.size() < id_index::buffer_size)
+        return small_id(value);
+
+    return find_upper(utils::to_upper_copy(std::string(value)));
+}
+
 id_index id_storage::add(std::string_view value)
 {
     if (value.size() < id_index::buffer_size)
@@ -57,5 +83,11 @@ id_index id_storage::add(std::string&& value)
 
     utils::to_upper(value);
 
+    if (base_)
+    {
+        if (auto result = base_->find_upper(value))
+            return *result;
+    }
+
     return id_index(std::to_address(lit_.insert(std::move(value)).first));
 }
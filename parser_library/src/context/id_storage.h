@@ -15,6 +15,7 @@
 #ifndef CONTEXT_LITERAL_STORAGE_H
 #define CONTEXT_LITERAL_STORAGE_H
 
+#include <memory>
 #include <optional>
 #include <string>
 #include <unordered_set>
@@ -24,15 +25,26 @@
 namespace hlasm_plugin::parser_library::context {
 // storage for identifiers
 // changes strings of identifiers to indexes of this storage class for easier and unified work
+// a storage may be layered on top of a read-only base, identifiers of the base remain valid in the layer
 class id_storage
 {
+    std::shared_ptr<const id_storage> base_;
     std::unordered_set<std::string> lit_;
 
     static id_index small_id(std::string_view value);
 
+    std::optional<id_index> find_upper(const std::string& value) const;
+
 public:
+    id_storage() = default;
+    explicit id_storage(std::shared_ptr<const id_storage> base);
+
+    const std::shared_ptr<const id_storage>& base() const noexcept { return base_; }
+
     size_t size() const;
     bool empty() const;
+    // approximate number of bytes held by the storage
+    size_t memory_usage() const;
 
     std::optional<id_index> find(std::string_view val) const;
 
@@ -19,6 +19,7 @@
 #include <stdexcept>
 
 #include "copy_member.h"
+#include "utils/memory_usage.h"
 #include "variables/system_variable.h"
 
 using namespace hlasm_plugin::parser_library;
@@ -90,6 +91,37 @@ macro_definition::macro_definition(id_index name,
     }
 }
 
+macro_definition::macro_definition(
+    const macro_definition& other, std::unordered_set<copy_member_ptr> used_copy_members)
+    : label_param_name_(other.label_param_name_)
+    , id(other.id)
+    , cached_definition(other.cached_definition)
+    , copy_nests(other.copy_nests)
+    , labels(other.labels)
+    , definition_location(other.definition_location)
+    , used_copy_members(std::move(used_copy_members))
+{
+    std::unordered_map<const macro_param_base*, const macro_param_base*> params;
+
+    positional_params_.reserve(other.positional_params_.size());
+    for (const auto& p : other.positional_params_)
+    {
+        auto& param = positional_params_.emplace_back();
+        if (!p)
+            continue;
+        param = std::make_unique<positional_param>(p->id, p->position, *macro_param_data_component::dummy);
+        params.emplace(p.get(), param.get());
+    }
+
+    keyword_params_.reserve(other.keyword_params_.size());
+    for (const auto& p : other.keyword_params_)
+        params.emplace(p.get(),
+            keyword_params_.emplace_back(std::make_unique<keyword_param>(p->id, p->default_data, nullptr)).get());
+
+    for (const auto& [name, p] : other.named_params_)
+        named_params_.emplace(name, params.at(p));
+}
+
 std::pair<std::unique_ptr<macro_invocation>, bool> macro_definition::call(
     macro_data_ptr label_param_data, std::vector<macro_arg> actual_params, id_index syslist_name)
 {
@@ -176,6 +208,19 @@ const std::vector<std::unique_ptr<keyword_param>>& macro_definition::get_keyword
 
 const id_index& macro_definition::get_label_param_name() const { return label_param_name_; }
 
+size_t macro_definition::memory_usage() const noexcept
+{
+    using namespace utils::memory_usage;
+
+    size_t result = sizeof(*this) + heap(cached_definition) + heap(copy_nests) + nodes(labels)
+        + nodes(named_params_) + nodes(used_copy_members);
+    for (const auto& stmt : cached_definition)
+        result += stmt.memory_usage() - sizeof(stmt);
+    for (const auto& nest : copy_nests)
+        result += heap(nest);
+    return result;
+}
+
 macro_invocation::macro_invocation(id_index name,
     cached_block& cached_definition,
     const copy_nest_storage& copy_nests,
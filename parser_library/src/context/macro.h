@@ -88,6 +88,8 @@ public:
         macro_label_storage labels,
         location definition_location,
         std::unordered_set<std::shared_ptr<copy_member>> used_copy_members);
+    // copies the definition with its own statement caches, so that the copy can be invoked independently
+    macro_definition(const macro_definition& other, std::unordered_set<std::shared_ptr<copy_member>> used_copy_members);
 
     // returns object with parameters' data set to actual parameters in macro call
     std::pair<std::unique_ptr<macro_invocation>, bool> call(
@@ -97,6 +99,9 @@ public:
     const std::vector<std::unique_ptr<keyword_param>>& get_keyword_params() const;
     const id_index& get_label_param_name() const;
 
+    // approximate number of bytes held by the definition
+    size_t memory_usage() const noexcept;
+
     const auto& get_copy_nest(statement_id stmt_id) const noexcept
     {
         assert(stmt_id.value < copy_nests.size());
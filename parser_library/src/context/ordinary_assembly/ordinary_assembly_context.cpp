@@ -29,8 +29,8 @@ namespace hlasm_plugin::parser_library::context {
 
 bool symbol_can_be_assigned(const auto& symbols, auto name)
 {
-    auto it = symbols.find(name);
-    return it == symbols.end() || std::holds_alternative<macro_label_tag>(it->second);
+    const auto* it = symbols.find(name);
+    return !it || std::holds_alternative<macro_label_tag>(it->second);
 }
 
 void ordinary_assembly_context::create_private_section()
@@ -92,23 +92,23 @@ void ordinary_assembly_context::add_symbol_reference(
 
 const symbol* ordinary_assembly_context::get_symbol_reference(context::id_index name) const
 {
-    auto tmp = symbol_refs_.find(name);
+    const auto* tmp = symbol_refs_.find(name);
 
-    return tmp == symbol_refs_.end() ? nullptr : &tmp->second;
+    return tmp ? &tmp->second : nullptr;
 }
 
 symbol* ordinary_assembly_context::get_symbol(id_index name)
 {
-    auto tmp = symbols_.find(name);
+    auto* tmp = symbols_.find(name);
 
-    return tmp == symbols_.end() ? nullptr : std::get_if<symbol>(&tmp->second);
+    return tmp ? std::get_if<symbol>(&tmp->second) : nullptr;
 }
 
 const symbol* ordinary_assembly_context::get_symbol(id_index name) const
 {
-    auto tmp = symbols_.find(name);
+    auto* tmp = symbols_.find(name);
 
-    return tmp == symbols_.end() ? nullptr : std::get_if<symbol>(&tmp->second);
+    return tmp ? std::get_if<symbol>(&tmp->second) : nullptr;
 }
 
 section* ordinary_assembly_context::get_section(id_index name) const noexcept
@@ -291,8 +291,8 @@ void ordinary_assembly_context::set_available_location_counter_value()
 
 bool ordinary_assembly_context::symbol_defined(id_index name) const
 {
-    auto it = symbols_.find(name);
-    return it != symbols_.end() && !std::holds_alternative<macro_label_tag>(it->second);
+    const auto* it = symbols_.find(name);
+    return it && !std::holds_alternative<macro_label_tag>(it->second);
 }
 
 bool ordinary_assembly_context::section_defined(id_index name, section_kind kind) const
@@ -399,8 +399,8 @@ void ordinary_assembly_context::generate_pool(
 }
 bool ordinary_assembly_context::is_using_label(id_index name) const
 {
-    auto it = symbols_.find(name);
-    return it != symbols_.end() && std::holds_alternative<using_label_tag>(it->second);
+    const auto* it = symbols_.find(name);
+    return it && std::holds_alternative<using_label_tag>(it->second);
 }
 
 void ordinary_assembly_context::register_using_label(id_index name)
@@ -17,7 +17,6 @@
 
 #include <memory>
 #include <optional>
-#include <unordered_map>
 #include <variant>
 #include <vector>
 
@@ -26,6 +25,7 @@
 #include "diagnostic_consumer.h"
 #include "section.h"
 #include "symbol.h"
+#include "symbol_table.h"
 #include "tagged_index.h"
 
 namespace hlasm_plugin::parser_library {
@@ -59,9 +59,9 @@ class ordinary_assembly_context
     // list of visited sections
     std::vector<std::unique_ptr<section>> sections_;
     // list of visited symbols
-    std::unordered_map<id_index, std::variant<symbol, using_label_tag, macro_label_tag>> symbols_;
+    symbol_table<std::variant<symbol, using_label_tag, macro_label_tag>> symbols_;
     // list of lookaheaded symbols
-    std::unordered_map<id_index, symbol> symbol_refs_;
+    symbol_table<symbol> symbol_refs_;
     // regenerate symbol addresses
     std::vector<symbol*> regenerate_symbols;
 
@@ -57,9 +57,9 @@ ordinary_assembly_dependency_solver::ordinary_assembly_dependency_solver(
 
 const symbol* ordinary_assembly_dependency_solver::get_symbol(id_index name) const
 {
-    auto tmp = ord_context.symbols_.find(name);
+    const auto* tmp = ord_context.symbols_.find(name);
 
-    return tmp == ord_context.symbols_.end() ? nullptr : std::get_if<symbol>(&tmp->second);
+    return tmp ? std::get_if<symbol>(&tmp->second) : nullptr;
 }
 
 std::optional<address> ordinary_assembly_dependency_solver::get_loctr() const { return loctr_addr; }
@@ -110,9 +110,9 @@ using_evaluate_result ordinary_assembly_dependency_solver::using_evaluate(
 std::variant<const symbol*, symbol_candidate> ordinary_assembly_dependency_solver::get_symbol_candidate(
     id_index name) const
 {
-    auto it = ord_context.symbols_.find(name);
+    const auto* it = ord_context.symbols_.find(name);
 
-    if (it == ord_context.symbols_.end())
+    if (!it)
     {
         if (ord_context.reporting_candidates)
             return symbol_candidate { false };
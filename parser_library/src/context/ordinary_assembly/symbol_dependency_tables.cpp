@@ -32,6 +32,16 @@
 #include "utils/projectors.h"
 
 namespace hlasm_plugin::parser_library::context {
+namespace {
+// symbols and their attributes share a single entry in the reverse dependency index
+dependant reverse_index_key(const dependant& d)
+{
+    if (const auto* a = std::get_if<attr_ref>(&d))
+        return a->symbol_id;
+    return d;
+}
+} // namespace
+
 bool symbol_dependency_tables::has_cycle(dependant target, std::vector<dependant> dependencies, const library_info& li)
 {
     if (dependencies.empty())
@@ -53,32 +63,68 @@ bool symbol_dependency_tables::has_cycle(dependant target, std::vector<dependant
         assert(false);
     };
 
+    // The exact forward search is interleaved with a backward search over the reverse index, which is a superset
+    // of the real dependency graph. Exhausting the backward search without reaching any of the dependencies proves
+    // that there is no cycle, which keeps the cost proportional to the smaller of the two searches.
+    refresh_stale(li);
+
     alignas(std::max_align_t) std::array<unsigned char, 8 * 1024> buffer;
     std::pmr::monotonic_buffer_resource buffer_resource(buffer.data(), buffer.size());
     std::pmr::unordered_set<dependant_ref> seen_before(&buffer_resource);
+    std::pmr::unordered_set<dependant> dependency_keys(&buffer_resource);
+    std::pmr::unordered_set<dependant> seen_backward(&buffer_resource);
+    std::pmr::vector<dependant> backward(&buffer_resource);
 
     for (const auto& d : dependencies)
+    {
         seen_before.emplace(dep_to_depref(d));
+        dependency_keys.emplace(reverse_index_key(d));
+    }
+
+    bool backward_active = !dependency_keys.contains(backward.emplace_back(reverse_index_key(target)));
+    seen_backward.emplace(backward.back());
 
     while (!dependencies.empty())
     {
         auto top_dep = std::move(dependencies.back());
         dependencies.pop_back();
 
-        auto dependant = find_dependency_value(top_dep);
-        if (!dependant)
+        if (auto dependant = find_dependency_value(top_dep))
+        {
+            for (auto&& dep : extract_dependencies(dependant->m_resolvable, dependant->m_dec, li))
+            {
+                if (dep == target)
+                {
+                    resolve_dependant_default(target);
+                    return true;
+                }
+                if (!seen_before.emplace(dep_to_depref(dep)).second)
+                    continue;
+                dependencies.emplace_back(std::move(dep));
+            }
+        }
+
+        if (!backward_active)
             continue;
+        if (backward.empty())
+            return false;
 
-        for (auto&& dep : extract_dependencies(dependant->m_resolvable, dependant->m_dec, li))
+        const auto it = m_dependants.find(backward.back());
+        backward.pop_back();
+        if (it == m_dependants.end())
+            continue;
+        for (const auto& waiting : it->second)
         {
-            if (dep == target)
+            if (!m_dependencies.contains(waiting))
+                continue;
+            auto key = reverse_index_key(waiting);
+            if (dependency_keys.contains(key))
             {
-                resolve_dependant_default(target);
-                return true;
+                backward_active = false;
+                break;
             }
-            if (!seen_before.emplace(dep_to_depref(dep)).second)
-                continue;
-            dependencies.emplace_back(std::move(dep));
+            if (seen_backward.emplace(key).second)
+                backward.emplace_back(std::move(key));
         }
     }
     return false;
@@ -277,196 +323,151 @@ struct resolve_dependant_default_visitor
 
 void symbol_dependency_tables::resolve_dependant_default(const dependant& target)
 {
-    m_dependencies_filters.reset_global(std::visit(dependant_hasher, target));
     std::visit(resolve_dependant_default_visitor { m_sym_ctx }, target);
+    notify_dependants(target);
 }
 
-class symbol_dependency_tables::dep_value
-{
-public:
-    // this type only exists to satisfy BiDirIt/RAIt requirements
-    // The functions below are intentionally not implemented
-    explicit(false) dep_value(dep_reference ref) noexcept;
-    dep_value& operator=(dep_reference ref) noexcept;
-};
-
-class symbol_dependency_tables::dep_reference
+void symbol_dependency_tables::swap_dependencies(size_t l, size_t r) noexcept
 {
-    size_t idx;
-    symbol_dependency_tables& self;
-
-    friend void swap(symbol_dependency_tables::dep_reference l, symbol_dependency_tables::dep_reference r) noexcept
-    {
-        assert(&l.self == &r.self);
-        if (l.idx == r.idx)
-            return;
-
-        auto& self = l.self;
+    if (l == r)
+        return;
 
-        using std::swap;
-        swap(self.m_dependencies_iterators[l.idx]->second.m_last_dependencies,
-            self.m_dependencies_iterators[r.idx]->second.m_last_dependencies);
-        swap(self.m_dependencies_iterators[l.idx], self.m_dependencies_iterators[r.idx]);
-        swap(self.m_dependencies_attributes[l.idx], self.m_dependencies_attributes[r.idx]);
-        self.m_dependencies_filters.swap(l.idx, r.idx);
-    }
-
-public:
-    constexpr dep_reference(size_t idx, symbol_dependency_tables& self) noexcept
-        : idx(idx)
-        , self(self)
-    {}
-
-    auto iterator() const noexcept { return self.m_dependencies_iterators[idx]; }
-    bool any_attr() const noexcept
-    {
-        const auto v = self.m_dependencies_attributes[idx];
-        return v.has_t_attr | v.space_ptr_type | v.delay_eval;
-    }
-    bool any() const noexcept { return self.m_dependencies_filters.any(idx); }
-
-    dep_reference(const dep_reference&) noexcept = default;
-    dep_reference(dep_reference&&) noexcept = default;
-
-    dep_reference& operator=(const dep_reference& o) noexcept = delete;
-    dep_reference& operator=(dep_reference&& o) noexcept = delete;
-
-    ~dep_reference() noexcept = default;
-};
+    using std::swap;
+    swap(m_dependencies_iterators[l]->second.m_last_dependencies, m_dependencies_iterators[r]->second.m_last_dependencies);
+    swap(m_dependencies_iterators[l], m_dependencies_iterators[r]);
+    swap(m_dependencies_attributes[l], m_dependencies_attributes[r]);
+    m_dependencies_filters.swap(l, r);
+}
 
-class symbol_dependency_tables::dep_iterator
+void symbol_dependency_tables::register_dependant(const dependant& what, const dependant& waiting)
 {
-    size_t idx;
-    symbol_dependency_tables* self;
-
-public:
-    using difference_type = std::ptrdiff_t;
-    using value_type = dep_value;
-    using pointer = dep_iterator;
-    using reference = dep_reference;
-    using iterator_category = std::random_access_iterator_tag;
-
-    constexpr dep_iterator() noexcept
-        : idx(0)
-        , self(nullptr)
-    {}
-    constexpr dep_iterator(size_t idx, symbol_dependency_tables* self) noexcept
-        : idx(idx)
-        , self(self)
-    {}
-
-    dep_iterator& operator++() noexcept
-    {
-        ++idx;
-        return *this;
-    }
-    dep_iterator& operator--() noexcept
-    {
-        --idx;
-        return *this;
-    }
-    dep_iterator operator++(int) noexcept
-    {
-        auto me = *this;
-        ++idx;
-        return me;
-    }
-    dep_iterator operator--(int) noexcept
-    {
-        auto me = *this;
-        --idx;
-        return me;
-    }
-
-    dep_reference operator*() const noexcept { return { idx, *self }; }
-    dep_reference operator[](difference_type offset) const noexcept { return { idx + offset, *self }; }
-
-    friend dep_iterator operator+(difference_type offset, dep_iterator it) noexcept { return it + offset; }
+    auto key = reverse_index_key(what);
+    if (!m_dependant_edges.emplace(key, waiting).second)
+        return;
+    m_dependants[std::move(key)].push_back(waiting);
+}
 
-    dep_iterator operator+(difference_type offset) const noexcept { return { idx + offset, self }; }
-    dep_iterator operator-(difference_type offset) const noexcept { return { idx - offset, self }; }
+void symbol_dependency_tables::notify_dependants(const dependant& what_changed)
+{
+    const auto key = reverse_index_key(what_changed);
+    const auto it = m_dependants.find(key);
+    if (it == m_dependants.end())
+        return;
 
-    dep_iterator& operator+=(difference_type offset) noexcept
-    {
-        idx += offset;
-        return *this;
-    }
-    dep_iterator& operator-=(difference_type offset) noexcept
-    {
-        idx -= offset;
-        return *this;
-    }
+    const auto waiting = std::move(it->second);
+    m_dependants.erase(it);
+    for (const auto& w : waiting)
+        m_dependant_edges.erase({ key, w });
 
-    difference_type operator-(const dep_iterator& o) const noexcept
+    const auto hash = std::visit(dependant_hasher, what_changed);
+    for (const auto& w : waiting)
     {
-        assert(self == o.self);
-        return idx - o.idx;
-    }
+        const auto dep_it = m_dependencies.find(w);
+        if (dep_it == m_dependencies.end())
+            continue;
+        const auto idx = dep_it->second.m_last_dependencies;
 
-    bool operator==(const dep_iterator& o) const noexcept
-    {
-        assert(self == o.self);
-        return idx == o.idx;
-    }
-    auto operator<=>(const dep_iterator& o) const noexcept
-    {
-        assert(self == o.self);
-        return idx <=> o.idx;
+        m_dependencies_filters.reset(hash, idx);
+        if (auto& attrs = m_dependencies_attributes[idx]; attrs.fresh)
+        {
+            attrs.fresh = false;
+            m_stale.push_back(w);
+        }
+        if (!m_dependencies_filters.any(idx))
+            enqueue_candidate(w, idx);
     }
-};
+}
 
-symbol_dependency_tables::dep_iterator symbol_dependency_tables::dependency_iterator(size_t idx)
+void symbol_dependency_tables::enqueue_candidate(const dependant& target, size_t idx)
 {
-    static_assert(std::random_access_iterator<dep_iterator>);
-    return dep_iterator { idx, this };
+    auto& attrs = m_dependencies_attributes[idx];
+    if (attrs.queued)
+        return;
+    attrs.queued = true;
+    if (attrs.has_t_attr | attrs.space_ptr_type | attrs.delay_eval)
+        m_attr_candidates.push_back(target);
+    else
+        m_candidates.push_back(target);
 }
 
-symbol_dependency_tables::dep_iterator symbol_dependency_tables::dep_begin() { return dependency_iterator(0); }
-symbol_dependency_tables::dep_iterator symbol_dependency_tables::dep_end()
+void symbol_dependency_tables::refresh_stale(const library_info& li)
 {
-    return dependency_iterator(m_dependencies_iterators.size());
+    for (const auto& target : std::exchange(m_stale, {}))
+    {
+        const auto it = m_dependencies.find(target);
+        if (it == m_dependencies.end())
+            continue;
+        const auto idx = it->second.m_last_dependencies;
+        if (m_dependencies_attributes[idx].fresh)
+            continue;
+        if (!update_dependencies(target, it->second, li) || !m_dependencies_filters.any(idx))
+            enqueue_candidate(target, idx);
+    }
 }
 
 void symbol_dependency_tables::resolve_loop(diagnostic_consumer* diags, const library_info& li)
 {
-    const auto has_dependency = [this, &li](auto dref) {
-        return dref.any() || update_dependencies(dref.iterator()->second, li);
-    };
-
-    const auto db = dep_begin();
-    auto e = dep_end();
-    const auto b = diags
-        ? db
-        : std::partition(dependency_iterator(m_dependencies_skip_index), e, [](auto dref) { return dref.any_attr(); });
-    m_dependencies_skip_index = b - db;
-
+    std::vector<dependant> resolvable;
     while (true)
     {
-        e = dep_end();
+        auto candidates = std::exchange(m_candidates, {});
+        if (diags)
+        {
+            candidates.insert(candidates.end(),
+                std::make_move_iterator(m_attr_candidates.begin()),
+                std::make_move_iterator(m_attr_candidates.end()));
+            m_attr_candidates.clear();
+        }
+
+        for (auto& target : candidates)
+        {
+            const auto it = m_dependencies.find(target);
+            if (it == m_dependencies.end())
+                continue;
+            const auto idx = it->second.m_last_dependencies;
+            auto& attrs = m_dependencies_attributes[idx];
+            if (!attrs.queued)
+                continue;
+            if (!diags && (attrs.has_t_attr | attrs.space_ptr_type | attrs.delay_eval))
+            {
+                m_attr_candidates.push_back(std::move(target));
+                continue;
+            }
+            attrs.queued = false;
 
-        const auto it = std::partition(b, e, has_dependency);
-        if (it == e)
+            if (m_dependencies_filters.any(idx))
+                continue;
+            if (update_dependencies(target, it->second, li))
+            {
+                if (!m_dependencies_filters.any(idx)) // only T attribute references remain
+                    enqueue_candidate(target, idx);
+                continue;
+            }
+            resolvable.push_back(std::move(target));
+        }
+
+        if (resolvable.empty())
             break;
 
-        auto accum = m_dependencies_filters.get_global_reset_accumulator();
-        while (it != e)
+        for (const auto& target : resolvable)
         {
-            --e;
-            const auto dep_it = (*e).iterator();
-            const auto& [target, dep_value] = *dep_it;
+            const auto dep_it = m_dependencies.find(target);
+            if (dep_it == m_dependencies.end())
+                continue;
+            const auto& dep_value = dep_it->second;
 
             resolve_dependant(target, dep_value.m_resolvable, diags, dep_value.m_dec, li); // resolve target
-            if (auto id = dep_it->second.related_statement_id)
+            if (auto id = dep_value.related_statement_id)
             {
                 auto& ref_count = m_postponed_stmts_references[id.value()];
                 assert(ref_count >= 1);
                 --ref_count;
             }
 
-            accum.reset(std::visit(dependant_hasher, target));
             delete_dependency(dep_it);
+            notify_dependants(target);
         }
-        m_dependencies_filters.reset_global(accum);
+        resolvable.clear();
     }
 }
 
@@ -525,16 +526,20 @@ std::vector<dependant> symbol_dependency_tables::extract_dependencies(
     return ret;
 }
 
-bool symbol_dependency_tables::update_dependencies(const dependency_value& d, const library_info& li)
+bool symbol_dependency_tables::update_dependencies(
+    const dependant& target, const dependency_value& d, const library_info& li)
 {
     context::ordinary_assembly_dependency_solver dep_solver(m_sym_ctx, d.m_dec, li);
     auto deps = d.m_resolvable->get_dependencies(dep_solver);
 
     m_dependencies_filters.reset(d.m_last_dependencies);
     m_dependencies_attributes[d.m_last_dependencies].has_t_attr = false;
+    m_dependencies_attributes[d.m_last_dependencies].fresh = true;
 
     for (const auto& ref : deps.undefined_symbolics)
     {
+        register_dependant(ref.name, target);
+
         if (ref.get(context::data_attr_kind::T))
             m_dependencies_attributes[d.m_last_dependencies].has_t_attr = true;
 
@@ -557,6 +562,7 @@ bool symbol_dependency_tables::update_dependencies(const dependency_value& d, co
 
     for (const auto& e : deps.unresolved_spaces)
     {
+        register_dependant(e, target);
         if (loctr_cnt && !unknown_loctr(e))
             continue;
         if (e->resolved())
@@ -566,6 +572,7 @@ bool symbol_dependency_tables::update_dependencies(const dependency_value& d, co
 
     for (const auto& [sp, _] : addr_spaces)
     {
+        register_dependant(sp, target);
         if (loctr_cnt && !unknown_loctr(sp))
             continue;
         m_dependencies_filters.set(dependant_hasher(sp), d.m_last_dependencies);
@@ -618,8 +625,6 @@ symbol_dependency_tables::dependency_value* symbol_dependency_tables::add_depend
 {
     if (has_cycle(target, extract_dependencies(dependency_source, dep_ctx, li), li))
     {
-        m_dependencies_filters.reset_global(dependant_hasher(target));
-
         resolve_loop(nullptr, li);
         return nullptr;
     }
@@ -635,8 +640,6 @@ symbol_dependency_tables::dependency_value* symbol_dependency_tables::add_depend
 {
     if (has_cycle(target, extract_dependencies(dependency_source, dep_ctx, li), li))
     {
-        m_dependencies_filters.reset_global(dependant_hasher(target));
-
         resolve_loop(nullptr, li);
         return nullptr;
     }
@@ -658,10 +661,15 @@ symbol_dependency_tables::dependency_value& symbol_dependency_tables::insert_dep
         .has_t_attr = false,
         .space_ptr_type = is_space_ptr,
         .delay_eval = delay_eval == delay_eval_t::yes,
+        .queued = false,
+        .fresh = false,
     });
 
     assert(inserted);
 
+    m_stale.push_back(it->first);
+    enqueue_candidate(it->first, it->second.m_last_dependencies);
+
     return it->second;
 }
 
@@ -669,9 +677,7 @@ void symbol_dependency_tables::delete_dependency(std::unordered_map<dependant, d
 {
     const auto me_idx = it->second.m_last_dependencies;
 
-    m_dependencies_skip_index = std::min(m_dependencies_skip_index, me_idx);
-
-    swap(dep_reference { me_idx, *this }, dep_reference { m_dependencies_iterators.size() - 1, *this });
+    swap_dependencies(me_idx, m_dependencies_iterators.size() - 1);
 
     m_dependencies_iterators.pop_back();
     m_dependencies_attributes.pop_back();
@@ -716,14 +722,11 @@ void symbol_dependency_tables::all_defined(diagnostic_consumer* diag_consumer, c
     resolve_loop(diag_consumer, li);
 }
 
-void symbol_dependency_tables::add_defined(id_index what_changed)
-{
-    m_dependencies_filters.reset_global(dependant_hasher(what_changed));
-}
+void symbol_dependency_tables::add_defined(id_index what_changed) { notify_dependants(what_changed); }
 
 void symbol_dependency_tables::add_defined(id_index what_changed, const library_info& li)
 {
-    m_dependencies_filters.reset_global(dependant_hasher(what_changed));
+    notify_dependants(what_changed);
 
     resolve_loop(nullptr, li);
 }
@@ -731,7 +734,7 @@ void symbol_dependency_tables::add_defined(id_index what_changed, const library_
 void symbol_dependency_tables::add_defined(
     space_ptr what_changed, diagnostic_consumer* diag_consumer, const library_info& li)
 {
-    m_dependencies_filters.reset_global(dependant_hasher(what_changed));
+    notify_dependants(what_changed);
 
     resolve_loop(diag_consumer, li);
 }
@@ -830,6 +833,11 @@ postponed_statements_t symbol_dependency_tables::collect_postponed()
     m_dependencies_iterators.clear();
     m_dependencies_filters.clear();
     m_dependencies_attributes.clear();
+    m_dependants.clear();
+    m_dependant_edges.clear();
+    m_candidates.clear();
+    m_attr_candidates.clear();
+    m_stale.clear();
 
     return result;
 }
@@ -18,6 +18,7 @@
 #include <optional>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -99,6 +100,10 @@ class symbol_dependency_tables
         bool has_t_attr : 1;
         bool space_ptr_type : 1;
         bool delay_eval : 1;
+        // dependency is waiting in one of the candidate lists
+        bool queued : 1;
+        // reverse index reflects the current dependencies
+        bool fresh : 1;
     };
 
     // actual dependecies of symbol or space
@@ -108,21 +113,37 @@ class symbol_dependency_tables
     utils::filter_vector<uint32_t> m_dependencies_filters;
     std::vector<dependency_attributes> m_dependencies_attributes;
 
+    // reverse dependency index: symbol or space -> dependencies that (may) wait for it
+    std::unordered_map<dependant, std::vector<dependant>> m_dependants;
+    struct dependant_edge_hasher
+    {
+        size_t operator()(const std::pair<dependant, dependant>& e) const noexcept
+        {
+            const std::hash<dependant> h;
+            return h(e.first) * 31 + h(e.second);
+        }
+    };
+    // (key, waiting) pairs present in m_dependants, re-registrations must not duplicate them
+    std::unordered_set<std::pair<dependant, dependant>, dependant_edge_hasher> m_dependant_edges;
+    // dependencies that may have become resolvable
+    std::vector<dependant> m_candidates;
+    // same as above, but only processed when all symbols are defined
+    std::vector<dependant> m_attr_candidates;
+    // dependencies whose entries in the reverse index need to be refreshed
+    std::vector<dependant> m_stale;
+
     dependency_value& insert_dependency(dependant target,
         const resolvable* dependency_source,
         const dependency_evaluation_context& dep_ctx,
         delay_eval_t delay_eval);
 
     void delete_dependency(std::unordered_map<dependant, dependency_value>::iterator it);
+    void swap_dependencies(size_t l, size_t r) noexcept;
 
-    class dep_value;
-    class dep_reference;
-    class dep_iterator;
-    friend void swap(dep_reference l, dep_reference r) noexcept;
-    dep_iterator dependency_iterator(size_t idx);
-    dep_iterator dep_begin();
-    dep_iterator dep_end();
-    size_t m_dependencies_skip_index = 0;
+    void register_dependant(const dependant& what, const dependant& waiting);
+    void notify_dependants(const dependant& what_changed);
+    void enqueue_candidate(const dependant& target, size_t idx);
+    void refresh_stale(const library_info& li);
 
     // list of statements containing dependencies that can not be checked yet
     postponed_statements_t m_postponed_stmts;
@@ -150,7 +171,7 @@ class symbol_dependency_tables
 
     std::vector<dependant> extract_dependencies(
         const resolvable* dependency_source, const dependency_evaluation_context& dep_ctx, const library_info& li);
-    bool update_dependencies(const dependency_value& v, const library_info& li);
+    bool update_dependencies(const dependant& target, const dependency_value& v, const library_info& li);
 
     dependency_value* add_dependency_with_cycle_check(id_index target,
         const resolvable* dependency_source,
@@ -0,0 +1,272 @@
+/*
+ * Copyright (c) 2025 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#ifndef CONTEXT_SYMBOL_TABLE_H
+#define CONTEXT_SYMBOL_TABLE_H
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "context/id_index.h"
+#include "utils/memory_usage.h"
+
+namespace hlasm_plugin::parser_library::context {
+
+// Open-addressing hash map keyed by id_index.
+// The index is a flat array of 8-byte slots (hash fragment + entry number) probed linearly,
+// the entries live in fixed-size chunks, so their addresses stay stable across rehashing and erasing.
+// Erased entries are recycled, iteration visits the live entries in the order of their entry numbers.
+template<typename T>
+class symbol_table
+{
+public:
+    using key_type = id_index;
+    using mapped_type = T;
+    using value_type = std::pair<const id_index, T>;
+
+private:
+    static constexpr size_t chunk_size = 64;
+    static constexpr uint32_t empty_slot = static_cast<uint32_t>(-1);
+    static constexpr uint32_t erased_slot = static_cast<uint32_t>(-2);
+
+    struct slot
+    {
+        uint32_t hash;
+        uint32_t entry;
+    };
+
+    std::vector<slot> slots_;
+    std::vector<std::unique_ptr<std::optional<value_type>[]>> chunks_;
+    std::vector<uint32_t> free_entries_;
+    uint32_t entries_used_ = 0;
+    size_t size_ = 0;
+    // live + erased slots
+    size_t occupied_slots_ = 0;
+
+    std::optional<value_type>& entry(uint32_t e) const noexcept { return chunks_[e / chunk_size][e % chunk_size]; }
+
+    // returns the slot index holding the key or slots_.size()
+    size_t find_slot(id_index key, uint32_t h) const noexcept
+    {
+        if (slots_.empty())
+            return 0;
+        const size_t mask = slots_.size() - 1;
+        for (size_t i = h & mask;; i = (i + 1) & mask)
+        {
+            const auto& s = slots_[i];
+            if (s.entry == empty_slot)
+                return slots_.size();
+            if (s.entry != erased_slot && s.hash == h && entry(s.entry)->first == key)
+                return i;
+        }
+    }
+
+    static uint32_t hash_of(id_index key) noexcept { return static_cast<uint32_t>(key.hash()); }
+
+    void place(uint32_t h, uint32_t e) noexcept
+    {
+        const size_t mask = slots_.size() - 1;
+        size_t i = h & mask;
+        while (slots_[i].entry != empty_slot && slots_[i].entry != erased_slot)
+            i = (i + 1) & mask;
+        if (slots_[i].entry == empty_slot)
+            ++occupied_slots_;
+        slots_[i] = { h, e };
+    }
+
+    void rehash(size_t new_size)
+    {
+        std::vector<slot> old(new_size, slot { 0, empty_slot });
+        old.swap(slots_);
+        occupied_slots_ = 0;
+        for (const auto& s : old)
+            if (s.entry != empty_slot && s.entry != erased_slot)
+                place(s.hash, s.entry);
+    }
+
+    void reserve_slot()
+    {
+        // keep the load factor (including tombstones) below 3/4
+        if ((occupied_slots_ + 1) * 4 <= slots_.size() * 3)
+            return;
+        size_t new_size = slots_.empty() ? 16 : slots_.size();
+        while ((size_ + 1) * 2 > new_size)
+            new_size *= 2;
+        rehash(new_size);
+    }
+
+    uint32_t allocate_entry()
+    {
+        if (!free_entries_.empty())
+        {
+            const auto e = free_entries_.back();
+            free_entries_.pop_back();
+            return e;
+        }
+        if (entries_used_ == chunks_.size() * chunk_size)
+            chunks_.emplace_back(std::make_unique<std::optional<value_type>[]>(chunk_size));
+        return entries_used_++;
+    }
+
+    template<typename... Args>
+    std::pair<value_type*, bool> emplace_new(id_index key, uint32_t h, Args&&... args)
+    {
+        reserve_slot();
+        const auto e = allocate_entry();
+        auto& v = entry(e);
+        v.emplace(std::piecewise_construct,
+            std::forward_as_tuple(key),
+            std::forward_as_tuple(std::forward<Args>(args)...));
+        place(h, e);
+        ++size_;
+        return { &*v, true };
+    }
+
+    template<bool is_const>
+    class iterator_impl
+    {
+        friend class symbol_table;
+
+        using table_t = std::conditional_t<is_const, const symbol_table, symbol_table>;
+
+        table_t* table = nullptr;
+        uint32_t e = 0;
+
+        void skip_holes() noexcept
+        {
+            while (e < table->entries_used_ && !table->entry(e).has_value())
+                ++e;
+        }
+
+        iterator_impl(table_t* t, uint32_t start) noexcept
+            : table(t)
+            , e(start)
+        {
+            skip_holes();
+        }
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = symbol_table::value_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<is_const, const value_type*, value_type*>;
+        using reference = std::conditional_t<is_const, const value_type&, value_type&>;
+
+        iterator_impl() = default;
+
+        reference operator*() const noexcept { return *table->entry(e); }
+        pointer operator->() const noexcept { return &*table->entry(e); }
+
+        iterator_impl& operator++() noexcept
+        {
+            ++e;
+            skip_holes();
+            return *this;
+        }
+        iterator_impl operator++(int) noexcept
+        {
+            auto result = *this;
+            ++*this;
+            return result;
+        }
+
+        bool operator==(const iterator_impl& o) const noexcept { return e == o.e; }
+    };
+
+public:
+    using iterator = iterator_impl<false>;
+    using const_iterator = iterator_impl<true>;
+
+    symbol_table() = default;
+    symbol_table(symbol_table&&) noexcept = default;
+    symbol_table& operator=(symbol_table&&) noexcept = default;
+
+    iterator begin() noexcept { return iterator(this, 0); }
+    iterator end() noexcept { return iterator(this, entries_used_); }
+    const_iterator begin() const noexcept { return const_iterator(this, 0); }
+    const_iterator end() const noexcept { return const_iterator(this, entries_used_); }
+
+    size_t size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+
+    value_type* find(id_index key) noexcept
+    {
+        const auto i = find_slot(key, hash_of(key));
+        return i == slots_.size() ? nullptr : &*entry(slots_[i].entry);
+    }
+    const value_type* find(id_index key) const noexcept
+    {
+        const auto i = find_slot(key, hash_of(key));
+        return i == slots_.size() ? nullptr : &*entry(slots_[i].entry);
+    }
+
+    bool contains(id_index key) const noexcept { return find(key) != nullptr; }
+
+    // inserts a new entry constructed from args unless the key is already present
+    template<typename... Args>
+    std::pair<value_type*, bool> try_emplace(id_index key, Args&&... args)
+    {
+        const auto h = hash_of(key);
+        if (const auto i = find_slot(key, h); i != slots_.size())
+            return { &*entry(slots_[i].entry), false };
+        return emplace_new(key, h, std::forward<Args>(args)...);
+    }
+
+    // the address of an existing entry is preserved
+    template<typename V>
+    std::pair<value_type*, bool> insert_or_assign(id_index key, V&& value)
+    {
+        const auto h = hash_of(key);
+        if (const auto i = find_slot(key, h); i != slots_.size())
+        {
+            auto* v = &*entry(slots_[i].entry);
+            v->second = std::forward<V>(value);
+            return { v, false };
+        }
+        return emplace_new(key, h, std::forward<V>(value));
+    }
+
+    size_t erase(id_index key)
+    {
+        const auto i = find_slot(key, hash_of(key));
+        if (i == slots_.size())
+            return 0;
+
+        const auto e = slots_[i].entry;
+        entry(e).reset();
+        free_entries_.push_back(e);
+        slots_[i].entry = erased_slot;
+        --size_;
+        return 1;
+    }
+
+    // approximate heap usage of the table itself, excluding memory owned by the values
+    size_t memory_usage() const noexcept
+    {
+        using namespace utils::memory_usage;
+        return heap(slots_) + heap(chunks_) + heap(free_entries_)
+            + chunks_.size() * (chunk_size * sizeof(std::optional<value_type>) + allocation_overhead);
+    }
+};
+
+} // namespace hlasm_plugin::parser_library::context
+
+#endif
@@ -15,6 +15,7 @@
 #include "statement_cache.h"
 
 #include "semantics/statement.h"
+#include "utils/memory_usage.h"
 
 namespace hlasm_plugin::parser_library::context {
 
@@ -37,4 +38,21 @@ const statement_cache::cached_statement_t* statement_cache::get(
     return nullptr;
 }
 
+size_t statement_cache::memory_usage() const noexcept
+{
+    // statements are polymorphic, so only a typical size of a statement with its operands is assumed
+    constexpr size_t approximate_statement_size = 512;
+
+    size_t result = sizeof(*this) + utils::memory_usage::heap(cache_);
+    if (base_stmt_)
+        result += approximate_statement_size;
+    for (const auto& [_, cached] : cache_)
+    {
+        if (cached.stmt)
+            result += approximate_statement_size;
+        result += utils::memory_usage::heap(cached.diags);
+    }
+    return result;
+}
+
 } // namespace hlasm_plugin::parser_library::context
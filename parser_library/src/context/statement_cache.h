@@ -51,6 +51,9 @@ public:
     const cached_statement_t* get(processing::processing_status_cache_key key) const noexcept;
 
     const shared_stmt_ptr& get_base() const noexcept { return base_stmt_; }
+
+    // approximate number of bytes held by the cache, every statement is counted as 512 bytes
+    size_t memory_usage() const noexcept;
 };
 
 using cached_block = std::vector<statement_cache>;
@@ -28,6 +28,7 @@
 #include "expressions/mach_expression.h"
 #include "ordinary_assembly/dependable.h"
 #include "ordinary_assembly/ordinary_assembly_dependency_solver.h"
+#include "utils/general_hashers.h"
 #include "utils/similar.h"
 
 constexpr std::string_view USING = "USING";
@@ -427,12 +428,39 @@ using_collection::evaluate_result using_collection::evaluate(
     if (!context_id)
         return evaluate_result { invalid_register, 0 };
 
-    auto tmp = get(context_id).context.evaluate(label, owner, offset, long_offset);
+    const auto compute = [&]() -> std::pair<register_t, offset_t> {
+        auto tmp = get(context_id).context.evaluate(label, owner, offset, long_offset);
 
-    if (tmp.length < 0)
-        return evaluate_result { invalid_register, 1 - tmp.length };
+        if (tmp.length < 0)
+            return { invalid_register, 1 - tmp.length };
+        else
+            return { tmp.mapping_regs[0], tmp.reg_offset };
+    };
+
+    if (!m_resolved)
+    {
+        const auto [reg, reg_offset] = compute();
+        return evaluate_result { reg, reg_offset };
+    }
+
+    ++m_evaluations;
+
+    const auto [it, inserted] =
+        m_evaluate_cache.try_emplace(evaluate_key { context_id.value(), label, owner, offset, long_offset });
+    if (inserted)
+        it->second = compute();
     else
-        return evaluate_result { tmp.mapping_regs[0], tmp.reg_offset };
+        ++m_evaluate_cache_hits;
+
+    return evaluate_result { it->second.first, it->second.second };
+}
+
+size_t using_collection::evaluate_key_hasher::operator()(const evaluate_key& k) const noexcept
+{
+    using utils::hashers::hash_combine;
+    auto h = hash_combine(std::hash<size_t>()(k.context_id), k.label.hash());
+    h = hash_combine(h, std::hash<const section*>()(k.owner));
+    return hash_combine(h, (size_t)(uint32_t)k.offset << 1 | k.long_offset);
 }
 
 bool hlasm_plugin::parser_library::context::using_collection::is_label_mapping_section(
@@ -23,6 +23,7 @@
 #include <memory>
 #include <optional>
 #include <span>
+#include <unordered_map>
 #include <vector>
 
 #include "id_index.h"
@@ -303,11 +304,31 @@ private:
         id_index label;
     };
 
+    struct evaluate_key
+    {
+        size_t context_id;
+        id_index label;
+        const section* owner;
+        offset_t offset;
+        bool long_offset;
+
+        bool operator==(const evaluate_key&) const noexcept = default;
+    };
+    struct evaluate_key_hasher
+    {
+        size_t operator()(const evaluate_key& k) const noexcept;
+    };
+
     std::vector<using_entry> m_usings;
     std::vector<expression_value> m_expr_values;
     std::vector<instruction_context> m_instruction_contexts;
     bool m_resolved = false;
 
+    // resolved using contexts never change, so the evaluation results can be reused
+    mutable std::unordered_map<evaluate_key, std::pair<register_t, offset_t>, evaluate_key_hasher> m_evaluate_cache;
+    mutable size_t m_evaluations = 0;
+    mutable size_t m_evaluate_cache_hits = 0;
+
     const auto& get(index_t<using_collection> idx) const
     {
         assert(idx);
@@ -361,6 +382,9 @@ public:
 
     std::vector<using_context_description> describe(index_t<using_collection> context_id) const;
 
+    size_t evaluations() const { return m_evaluations; }
+    size_t evaluate_cache_hits() const { return m_evaluate_cache_hits; }
+
     bool is_label_mapping_section(index_t<using_collection> context_id, id_index label, const section* owner) const;
 };
 
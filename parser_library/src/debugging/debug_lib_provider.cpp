@@ -17,6 +17,7 @@
 #include <cassert>
 
 #include "analyzer.h"
+#include "context/hlasm_context.h"
 #include "utils/task.h"
 #include "workspaces/file_manager.h"
 #include "workspaces/library.h"
@@ -24,10 +25,12 @@
 
 namespace hlasm_plugin::parser_library::debugging {
 
-debug_lib_provider::debug_lib_provider(
-    std::vector<std::shared_ptr<workspaces::library>> libraries, workspaces::file_manager& fm)
+debug_lib_provider::debug_lib_provider(std::vector<std::shared_ptr<workspaces::library>> libraries,
+    workspaces::file_manager& fm,
+    std::unordered_map<utils::resource::resource_location, workspaces::macro_cache> macro_caches)
     : m_libraries(std::move(libraries))
     , m_file_manager(fm)
+    , m_macro_caches(std::move(macro_caches))
 {}
 
 utils::value_task<bool> debug_lib_provider::parse_library(
@@ -39,6 +42,14 @@ utils::value_task<bool> debug_lib_provider::parse_library(
         if (!lib->has_file(library, &url))
             continue;
 
+        if (auto it = m_macro_caches.find(url); it != m_macro_caches.end())
+        {
+            auto cache_key =
+                workspaces::macro_cache_key::create_from_context(*ctx.hlasm_ctx, kind, ctx.hlasm_ctx->add_id(library));
+            if (it->second.load_from_cache(cache_key, ctx).has_value())
+                co_return true;
+        }
+
         auto content_o = co_await m_file_manager.get_converted_file_content(url);
         if (!content_o.has_value())
             break;
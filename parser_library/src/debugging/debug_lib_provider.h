@@ -25,6 +25,7 @@
 
 #include "parse_lib_provider.h"
 #include "utils/resource_location.h"
+#include "workspaces/macro_cache.h"
 
 namespace hlasm_plugin::utils {
 class task;
@@ -43,15 +44,19 @@ namespace hlasm_plugin::parser_library::debugging {
 
 // Implements dependency (macro and COPY files) fetcher for macro tracer.
 // Takes the information from a workspace, but calls special methods for
-// parsing that do not collide with LSP.
+// parsing that do not collide with LSP. Macro caches shared by the workspace are
+// used before falling back to parsing the dependencies.
 class debug_lib_provider final : public parse_lib_provider
 {
     std::unordered_map<utils::resource::resource_location, std::string> m_files;
     std::vector<std::shared_ptr<workspaces::library>> m_libraries;
     workspaces::file_manager& m_file_manager;
+    std::unordered_map<utils::resource::resource_location, workspaces::macro_cache> m_macro_caches;
 
 public:
-    debug_lib_provider(std::vector<std::shared_ptr<workspaces::library>> libraries, workspaces::file_manager& fm);
+    debug_lib_provider(std::vector<std::shared_ptr<workspaces::library>> libraries,
+        workspaces::file_manager& fm,
+        std::unordered_map<utils::resource::resource_location, workspaces::macro_cache> macro_caches = {});
 
     [[nodiscard]] utils::value_task<bool> parse_library(
         std::string library, analyzing_context ctx, processing::processing_kind kind) override;
@@ -19,6 +19,7 @@
 #include <functional>
 #include <memory>
 #include <optional>
+#include <ranges>
 #include <string_view>
 #include <unordered_map>
 #include <utility>
@@ -93,6 +94,15 @@ class debugger::impl final : public processing::statement_analyzer, output_handl
     // True, if disconnect request was received
     bool disconnected_ = false;
 
+    // The analysis is deterministic, so a previous state is reached again by replaying it from the start
+    // to the ordinal of the executed statement. Events and outputs are suppressed until the target is reached.
+    debugger_configuration_provider* dc_provider_ = nullptr;
+    bool stop_on_entry_ = false;
+    size_t executed_statements_ = 0;
+    size_t current_statement_ = 0;
+    std::optional<size_t> replay_target_;
+    std::vector<size_t> breakpoint_stops_;
+
     // Provides a way to inform outer world about debugger events
     debug_event_consumer* event_ = nullptr;
 
@@ -108,7 +118,13 @@ class debugger::impl final : public processing::statement_analyzer, output_handl
     size_t next_var_ref_ = 1;
     context::processing_stack_details_t proc_stack_;
 
-    std::unordered_map<utils::resource::resource_location, std::vector<breakpoint>> breakpoints_;
+    struct file_breakpoints
+    {
+        std::vector<breakpoint> list;
+        // bitmap of lines with a breakpoint, tested on every executed statement
+        std::vector<bool> lines;
+    };
+    std::unordered_map<utils::resource::resource_location, file_breakpoints> breakpoints_;
 
     std::unordered_set<std::string, utils::hashers::string_hasher, std::equal_to<>> function_breakpoints_;
 
@@ -136,7 +152,7 @@ class debugger::impl final : public processing::statement_analyzer, output_handl
             co_return;
         }
         resp.provide(true);
-        debug_lib_provider debug_provider(std::move(dc.libraries), *dc.fm);
+        debug_lib_provider debug_provider(std::move(dc.libraries), *dc.fm, std::move(dc.macro_caches.caches));
         workspaces::file_manager_vfm vfm(*dc.fm);
 
         if (auto prefetch = debug_provider.prefetch_libraries(); prefetch.valid())
@@ -148,6 +164,7 @@ class debugger::impl final : public processing::statement_analyzer, output_handl
                 &debug_provider,
                 std::move(dc.opts),
                 std::move(dc.pp_opts),
+                std::move(dc.macro_caches.ids),
                 &vfm,
                 static_cast<output_handler*>(this),
             });
@@ -162,28 +179,24 @@ class debugger::impl final : public processing::statement_analyzer, output_handl
 
     void mnote(unsigned char level, std::string_view text) override
     {
-        if (event_)
+        if (event_ && !replay_target_)
             event_->mnote(level, text);
     }
 
     void punch(std::string_view text) override
     {
-        if (event_)
+        if (event_ && !replay_target_)
             event_->punch(text);
     }
 
-public:
-    impl() = default;
-
-    void launch(std::string_view source,
-        debugger_configuration_provider& dc_provider,
-        bool stop_on_entry,
-        workspace_manager_response<bool> resp)
+    void start(workspace_manager_response<bool> resp)
     {
-        opencode_source_uri_ = source;
         continue_ = true;
-        stop_on_next_stmt_ = stop_on_entry;
+        debug_ended_ = false;
+        stop_on_next_stmt_ = stop_on_entry_ && !replay_target_;
         stop_on_stack_changes_ = false;
+        stop_on_stack_condition_ = {};
+        executed_statements_ = 0;
 
         struct conf_t
         {
@@ -193,11 +206,58 @@ public:
             void error(int, const char*) const noexcept {}
         };
         auto [conf_resp, conf] = make_workspace_manager_response(std::in_place_type<conf_t>);
-        dc_provider.provide_debugger_configuration(source, conf_resp);
-        analyzer_task =
-            utils::async_busy_wait(std::move(conf_resp), &conf->conf)
-                .then(std::bind_front(
-                    &impl::start_main_analyzer, this, utils::resource::resource_location(source), std::move(resp)));
+        dc_provider_->provide_debugger_configuration(opencode_source_uri_, conf_resp);
+        analyzer_task = utils::async_busy_wait(std::move(conf_resp), &conf->conf)
+                            .then(std::bind_front(&impl::start_main_analyzer,
+                                this,
+                                utils::resource::resource_location(opencode_source_uri_),
+                                std::move(resp)));
+    }
+
+    void replay(std::optional<size_t> target)
+    {
+        if (!dc_provider_ || disconnected_)
+            return;
+
+        analyzer_task = {};
+        ctx_ = nullptr;
+        lib_provider_ = nullptr;
+        variables_.clear();
+        stack_frames_.clear();
+        scopes_.clear();
+        proc_stack_.clear();
+        last_system_variables_.clear();
+
+        if (target)
+            std::erase_if(breakpoint_stops_, [t = *target](auto s) { return s >= t; });
+        else
+            breakpoint_stops_.clear();
+        replay_target_ = target;
+
+        struct ignore_t
+        {
+            void provide(bool) const noexcept {}
+            void error(int, const char*) const noexcept {}
+        };
+        start(make_workspace_manager_response(ignore_t {}).first);
+    }
+
+public:
+    impl() = default;
+
+    void launch(std::string_view source,
+        debugger_configuration_provider& dc_provider,
+        bool stop_on_entry,
+        workspace_manager_response<bool> resp)
+    {
+        opencode_source_uri_ = source;
+        dc_provider_ = &dc_provider;
+        stop_on_entry_ = stop_on_entry;
+        current_statement_ = 0;
+        replay_target_.reset();
+        breakpoint_stops_.clear();
+
+        start(std::move(resp));
     }
 
     void step(const std::atomic<unsigned char>* yield_indicator)
@@ -249,22 +309,29 @@ public:
         if (op_code.empty())
             return false;
 
+        ++executed_statements_;
+        if (replay_target_)
+        {
+            if (executed_statements_ < *replay_target_)
+                return false;
+            replay_target_.reset();
+            stop_on_next_stmt_ = true;
+        }
+
         const bool actr_limit = ctx_->get_branch_counter() < 0;
 
-        const bool function_breakpoint_hit = function_breakpoints_.contains(op_code.to_string_view());
+        const bool function_breakpoint_hit =
+            !function_breakpoints_.empty() && function_breakpoints_.contains(op_code.to_string_view());
 
-        range stmt_range = resolved_stmt->stmt_range_ref();
+        const bool stop_requested = stop_on_next_stmt_ || function_breakpoint_hit || actr_limit;
 
-        bool breakpoint_hit = false;
+        // Running to a breakpoint: nothing is materialized until the execution actually stops
+        if (!stop_requested && !stop_on_stack_changes_ && breakpoints_.empty())
+            return false;
 
-        auto stack_node = ctx_->processing_stack();
-        auto stack = ctx_->processing_stack_details();
+        const auto stack_node = ctx_->processing_stack();
 
-        for (const auto& bp : breakpoints(stack.back().resource_loc))
-        {
-            if (bp.line >= stmt_range.start.line && bp.line <= stmt_range.end.line)
-                breakpoint_hit = true;
-        }
+        const bool breakpoint_hit = has_breakpoint(stack_node.frame().resource_loc, resolved_stmt->stmt_range_ref());
 
         const auto stack_condition_violated = [&cond = stop_on_stack_condition_](context::processing_stack_t cur) {
             auto last = cur;
@@ -275,13 +342,12 @@ public:
         };
 
         // breakpoint check
-        if (stop_on_next_stmt_ || breakpoint_hit || function_breakpoint_hit || actr_limit
-            || (stop_on_stack_changes_ && stack_condition_violated(stack_node)))
+        if (stop_requested || breakpoint_hit || (stop_on_stack_changes_ && stack_condition_violated(stack_node)))
         {
             variables_.clear();
             stack_frames_.clear();
             scopes_.clear();
-            proc_stack_ = std::move(stack);
+            proc_stack_ = ctx_->processing_stack_details();
             last_system_variables_.clear();
 
             if (disconnected_)
@@ -291,6 +357,9 @@ public:
             stop_on_stack_condition_ = std::make_pair(stack_node, std::nullopt);
 
             continue_ = false;
+            current_statement_ = executed_statements_;
+            if (breakpoint_hit || function_breakpoint_hit)
+                breakpoint_stops_.push_back(current_statement_);
 
             static constexpr std::string_view reasons[] = {
                 "entry",
@@ -355,6 +424,31 @@ public:
 
     void pause() { stop_on_next_stmt_ = true; }
 
+    void restart() { replay(std::nullopt); }
+
+    void step_back()
+    {
+        if (continue_ || current_statement_ == 0)
+            return;
+        replay(std::max<size_t>(current_statement_ - 1, 1));
+    }
+
+    void reverse_continue()
+    {
+        if (continue_ || current_statement_ == 0)
+            return;
+        size_t target = 1;
+        for (auto stop : breakpoint_stops_ | std::views::reverse)
+        {
+            if (stop < current_statement_)
+            {
+                target = stop;
+                break;
+            }
+        }
+        replay(target);
+    }
+
     static std::string fpt_to_string(context::file_processing_type fpt)
     {
         switch (fpt)
@@ -730,16 +824,39 @@ public:
 
     void breakpoints(const utils::resource::resource_location& source, std::span<const breakpoint> bps)
     {
-        breakpoints_[source].assign(bps.begin(), bps.end());
+        if (bps.empty())
+        {
+            breakpoints_.erase(source);
+            return;
+        }
+
+        auto& [list, lines] = breakpoints_[source];
+        list.assign(bps.begin(), bps.end());
+        lines.assign(std::ranges::max(list, {}, &breakpoint::line).line + 1, false);
+        for (const auto& bp : list)
+            lines[bp.line] = true;
     }
 
     [[nodiscard]] std::span<const breakpoint> breakpoints(const utils::resource::resource_location& source) const
     {
         if (auto it = breakpoints_.find(source); it != breakpoints_.end())
-            return it->second;
+            return it->second.list;
         return {};
     }
 
+    [[nodiscard]] bool has_breakpoint(const utils::resource::resource_location& source, const range& r) const
+    {
+        auto it = breakpoints_.find(source);
+        if (it == breakpoints_.end())
+            return false;
+
+        const auto& lines = it->second.lines;
+        for (size_t line = r.start.line, end = std::min(r.end.line + 1, lines.size()); line < end; ++line)
+            if (lines[line])
+                return true;
+        return false;
+    }
+
     void function_breakpoints(std::span<const function_breakpoint> bps)
     {
         function_breakpoints_.clear();
@@ -784,6 +901,9 @@ void debugger::step_out() { pimpl->step_out(); }
 void debugger::disconnect() { pimpl->disconnect(); }
 void debugger::continue_debug() { pimpl->continue_debug(); }
 void debugger::pause() { pimpl->pause(); }
+void debugger::restart() { pimpl->restart(); }
+void debugger::step_back() { pimpl->step_back(); }
+void debugger::reverse_continue() { pimpl->reverse_continue(); }
 void debugger::analysis_step(const std::atomic<unsigned char>* yield_indicator) { pimpl->step(yield_indicator); }
 
 
@@ -16,6 +16,7 @@
 #define HLASMPLUGIN_PARSERLIBRARY_DEBUGGING_DEBUGGER_CONFIGURATION_H
 
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
 #include "compiler_options.h"
@@ -23,15 +24,28 @@
 #include "utils/resource_location.h"
 #include "workspaces/file_manager.h"
 #include "workspaces/library.h"
+#include "workspaces/macro_cache.h"
+
+namespace hlasm_plugin::parser_library::context {
+class id_storage;
+} // namespace hlasm_plugin::parser_library::context
 
 namespace hlasm_plugin::parser_library::debugging {
 
+// Macro caches of the workspace together with the identifier storage they are tied to
+struct shared_macro_caches
+{
+    std::shared_ptr<context::id_storage> ids;
+    std::unordered_map<utils::resource::resource_location, workspaces::macro_cache> caches;
+};
+
 struct debugger_configuration
 {
     workspaces::file_manager* fm = nullptr;
     std::vector<std::shared_ptr<workspaces::library>> libraries;
     asm_option opts;
     std::vector<preprocessor_options> pp_opts;
+    shared_macro_caches macro_caches;
 };
 
 } // namespace hlasm_plugin::parser_library::debugging
@@ -17,6 +17,8 @@
 #include <algorithm>
 #include <ranges>
 
+#include "utils/memory_usage.h"
+
 namespace {
 constexpr auto occurrence_end_line(const hlasm_plugin::parser_library::lsp::symbol_occurrence& o)
 {
@@ -256,6 +258,12 @@ file_slice_t file_slice_t::transform_slice(
 
 const std::vector<symbol_occurrence>& file_info::get_occurrences() const { return occurrences; }
 
+size_t file_info::memory_usage() const noexcept
+{
+    using utils::memory_usage::heap;
+    return sizeof(*this) + heap(slices) + heap(occurrences) + heap(line_details) + heap(occurrences_start_limit);
+}
+
 void file_info::process_occurrences()
 {
     std::ranges::sort(occurrences, {}, [](const auto& e) {
@@ -113,6 +113,9 @@ public:
 
     std::vector<bool> macro_map() const;
 
+    // approximate number of bytes held by the occurrence indexes
+    size_t memory_usage() const noexcept;
+
     static void distribute_macro_slices(
         const std::unordered_map<const context::macro_definition*, macro_info_ptr>& macros,
         std::unordered_map<utils::resource::resource_location, file_info>& files);
@@ -14,9 +14,12 @@
 
 #include "item_convertors.h"
 
+#include <algorithm>
+#include <array>
 #include <concepts>
 #include <format>
 #include <limits>
+#include <span>
 
 #include "completion_item.h"
 #include "context/hlasm_context.h"
@@ -435,6 +438,53 @@ std::vector<completion_item> generate_completion(
     return items;
 }
 
+namespace {
+constexpr unsigned char upper(char c) noexcept { return utils::upper_cased[(unsigned char)c]; }
+
+constexpr bool less_case_insensitive(std::string_view l, std::string_view r) noexcept
+{
+    return std::ranges::lexicographical_compare(l, r, {}, upper, upper);
+}
+
+// Emulates the filtering of the editor - the first character must match, the rest is a subsequence of the label
+constexpr bool completion_matches(std::string_view label, std::string_view typed) noexcept
+{
+    if (typed.empty())
+        return true;
+    if (label.empty() || upper(label.front()) != upper(typed.front()))
+        return false;
+
+    auto l = label.begin() + 1;
+    for (char c : typed.substr(1))
+    {
+        l = std::find_if(l, label.end(), [u = upper(c)](char x) { return upper(x) == u; });
+        if (l == label.end())
+            return false;
+        ++l;
+    }
+    return true;
+}
+
+// Instruction completion items available in each instruction set, sorted by label
+const std::vector<const completion_item*>& instruction_completion_index(instruction_set_version instr_set)
+{
+    static constexpr auto set_count = (size_t)instruction_set_version::UNI + 1;
+    static const auto index = []() {
+        std::array<std::vector<const completion_item*>, set_count> result;
+        for (size_t set = 0; set < set_count; ++set)
+        {
+            auto& items = result[set];
+            for (const auto& [instr, aff] : instruction_completion_items)
+                if (instructions::instruction_available(aff, (instruction_set_version)set))
+                    items.push_back(&instr);
+            std::ranges::sort(items, less_case_insensitive, &completion_item::label);
+        }
+        return result;
+    }();
+    return index[(size_t)instr_set];
+}
+} // namespace
+
 std::vector<completion_item> generate_completion(
     const completion_list_instructions& cli, const utils::text_convertor* tc)
 {
@@ -443,7 +493,7 @@ std::vector<completion_item> generate_completion(
     const utils::conversion_helper convertor { tc };
 
     const auto& hlasm_ctx = cli.lsp_ctx->get_related_hlasm_context();
-    const auto instruction_set = hlasm_ctx.options().instr_set;
+    const auto& instructions = instruction_completion_index(hlasm_ctx.options().instr_set);
 
     std::vector<std::pair<std::string, bool>> suggestions;
     suggestions.reserve(cli.additional_instructions.size());
@@ -458,11 +508,7 @@ std::vector<completion_item> generate_completion(
     std::vector<completion_item> result;
     const auto completed_text = convertor.convert_to(cli.completed_text);
 
-    // Store only instructions from the currently active instruction set
-    for (const auto& [instr, aff] : instruction_completion_items)
-    {
-        if (!instructions::instruction_available(aff, instruction_set))
-            continue;
+    const auto add_instruction = [&](const completion_item& instr) {
         // Coversion should not be needed
         auto& i = result.emplace_back(instr);
         if (auto space = i.insert_text.find(' '); space != std::string::npos)
@@ -476,10 +522,37 @@ std::vector<completion_item> generate_completion(
             i.suggestion_for = completed_text;
             suggestion->second = true;
         }
+    };
+
+    // Only instructions matching the completed text are returned, the list is marked as incomplete,
+    // so the editor asks again when the user continues typing
+    const auto first_letter = [](const completion_item* i) { return upper(i->label.front()); };
+    std::span<const completion_item* const> candidates = instructions;
+    if (!cli.completed_text.empty())
+        candidates = std::ranges::equal_range(instructions, upper(cli.completed_text.front()), {}, first_letter);
+
+    for (const auto* instr : candidates)
+        if (completion_matches(instr->label, cli.completed_text) || locate_suggestion(instr->label))
+            add_instruction(*instr);
+
+    // Suggested instructions starting with a different letter
+    for (const auto& [suggestion, _] : suggestions)
+    {
+        if (cli.completed_text.empty() || suggestion.empty()
+            || upper(suggestion.front()) == upper(cli.completed_text.front()))
+            continue;
+        const auto it =
+            std::ranges::lower_bound(instructions, suggestion, less_case_insensitive, &completion_item::label);
+        if (it != instructions.end() && (*it)->label == suggestion)
+            add_instruction(**it);
     }
 
     for (const auto& [_, macro_i] : *cli.macros)
     {
+        if (const auto name = macro_i->macro_definition->id.to_string_view();
+            !completion_matches(name, cli.completed_text) && !locate_suggestion(name))
+            continue;
+
         auto& i = result.emplace_back(generate_completion_item(
             *macro_i, cli.lsp_ctx->get_file_info(macro_i->definition_location.resource_loc), tc));
         if (auto* suggestion = locate_suggestion(i.label);
@@ -30,6 +30,7 @@
 #include "lsp/instruction_completions.h"
 #include "lsp/macro_info.h"
 #include "parse_lib_provider.h"
+#include "utils/memory_usage.h"
 #include "utils/string_operations.h"
 #include "utils/unicode_text.h"
 
@@ -295,6 +296,46 @@ void lsp_context::add_opencode(opencode_info_ptr opencode_i, text_data_view text
     std::erase_if(m_instr_like, [](const auto& e) { return e.second.empty(); });
 }
 
+namespace {
+size_t occurrences_memory_usage(const file_occurrences_t& occurrences) noexcept
+{
+    using namespace utils::memory_usage;
+    size_t result = nodes(occurrences);
+    for (const auto& [_, o] : occurrences)
+        result += heap(o.symbols) + heap(o.line_details);
+    return result;
+}
+} // namespace
+
+size_t lsp_context::memory_usage() const noexcept
+{
+    using namespace utils::memory_usage;
+
+    size_t result = sizeof(*this) + nodes(m_macros) + nodes(m_files) + nodes(m_instr_like) + heap(m_titles);
+
+    if (m_opencode)
+        result += sizeof(*m_opencode) + heap(m_opencode->variable_definitions)
+            + occurrences_memory_usage(m_opencode->file_occurrences);
+
+    for (const auto& [def, info] : m_macros)
+    {
+        result += sizeof(*info) + heap(info->var_definitions) + nodes(info->file_scopes)
+            + occurrences_memory_usage(info->file_occurrences);
+        for (const auto& [_, scope] : info->file_scopes)
+            result += heap(scope.first);
+        if (!info->external && def)
+            result += def->memory_usage();
+    }
+
+    for (const auto& [_, file] : m_files)
+        result += file.memory_usage() - sizeof(file);
+
+    for (const auto& t : m_titles)
+        result += heap(t.title);
+
+    return result;
+}
+
 void lsp_context::add_title(std::string title, context::processing_stack_t stack)
 {
     m_titles.emplace_back(std::move(title), std::move(stack));
@@ -106,6 +106,10 @@ public:
 
     std::vector<branch_info> get_opencode_branch_info() const;
 
+    // approximate number of bytes held by the context, external macro definitions are accounted for by the macro
+    // cache and the processing context is not included
+    size_t memory_usage() const noexcept;
+
 private:
     void distribute_file_occurrences(const file_occurrences_t& occurrences);
 
@@ -117,15 +117,16 @@ std::pair<char_substitution, size_t> append_utf8_with_newlines(
     size_t utf16_length = 0;
     while (!s.empty())
     {
-        char8_t c = s.front();
-        if (c < 0x80)
+        if (const auto ascii = utils::ascii_prefix_length(s))
         {
-            t.push_back(c);
-            s.remove_prefix(1);
-            ++utf16_length;
+            t.insert(t.end(), s.data(), s.data() + ascii);
+            s.remove_prefix(ascii);
+            utf16_length += ascii;
             continue;
         }
-        else if (c == lexing::u8string_view_with_newlines::EOL)
+
+        char8_t c = s.front();
+        if (c == lexing::u8string_view_with_newlines::EOL)
         {
             nl.push_back(t.size());
             ll.push_back(std::exchange(utf16_length, 0));
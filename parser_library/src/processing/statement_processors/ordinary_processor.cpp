@@ -26,6 +26,7 @@
 #include "context/ordinary_assembly/location_counter.h"
 #include "context/ordinary_assembly/ordinary_assembly_dependency_solver.h"
 #include "context/ordinary_assembly/symbol_dependency_tables.h"
+#include "context/using.h"
 #include "context/well_known.h"
 #include "diagnostic_consumer.h"
 #include "ebcdic_encoding.h"
@@ -188,6 +189,9 @@ void ordinary_processor::end_processing()
 
     process_postponed_statements(hlasm_ctx.ord_ctx.symbol_dependencies().collect_postponed());
 
+    hlasm_ctx.metrics.using_evaluations = hlasm_ctx.usings().evaluations();
+    hlasm_ctx.metrics.using_evaluation_cache_hits = hlasm_ctx.usings().evaluate_cache_hits();
+
     hlasm_ctx.pop_statement_processing();
 
     listener_.finish_opencode();
@@ -318,11 +318,11 @@ class workspace_manager_impl final : public workspace_manager,
 
         std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
 
-        const auto& [url, metadata, perf_metrics, errors, warnings, outputs_changed] = task.value();
+        const auto& [url, metadata, perf_metrics, errors, warnings, memory, outputs_changed] = task.value();
 
         if (perf_metrics)
         {
-            parsing_metadata data { perf_metrics.value(), metadata, errors, warnings };
+            parsing_metadata data { perf_metrics.value(), metadata, errors, warnings, memory };
             for (auto consumer : m_parsing_metadata_consumers)
                 consumer->consume_parsing_metadata(url.get_uri(), duration.count(), data);
         }
@@ -906,6 +906,52 @@ class workspace_manager_impl final : public workspace_manager,
         return load_text_external(document_loc);
     }
 
+    [[nodiscard]] utils::value_task<std::vector<std::optional<std::string>>> load_texts(
+        std::vector<utils::resource::resource_location> document_locs) const override
+    {
+        struct content_t
+        {
+            std::optional<std::string> result;
+
+            void provide(std::string_view c) { result = std::string(c); }
+            void error(int, const char*) noexcept { result.reset(); }
+        };
+
+        std::vector<std::optional<std::string>> result(document_locs.size());
+
+        std::vector<std::string_view> urls;
+        std::vector<workspace_manager_response<std::string_view>> channels;
+        std::vector<std::pair<size_t, content_t*>> pending;
+        for (size_t i = 0; i < document_locs.size(); ++i)
+        {
+            const auto& loc = document_locs[i];
+            if (loc.is_local() && !utils::platform::is_web())
+                result[i] = utils::resource::load_text(loc);
+            else if (m_args.external_requests && m_args.vscode_extensions && allowed_scheme(loc))
+            {
+                auto [channel, data] = make_workspace_manager_response(std::in_place_type<content_t>);
+                urls.emplace_back(loc.get_uri());
+                channels.emplace_back(std::move(channel));
+                pending.emplace_back(i, data);
+            }
+        }
+
+        // one round trip for all external files
+        if (!urls.empty())
+            m_args.external_requests->read_external_files(urls, channels);
+
+        for (const auto& channel : channels)
+        {
+            while (!channel.resolved())
+                co_await utils::task::suspend();
+        }
+
+        for (const auto& [i, data] : pending)
+            result[i] = std::move(data->result);
+
+        co_return result;
+    }
+
     [[nodiscard]] utils::value_task<std::pair<std::vector<std::pair<std::string, utils::resource::resource_location>>,
         utils::path::list_directory_rc>>
     list_directory_files_external(const utils::resource::resource_location& directory, bool subdir) const
@@ -1111,15 +1157,17 @@ class workspace_manager_impl final : public workspace_manager,
             {
                 next_unique_id(),
                 std::function<utils::task()>([this, uri = std::move(uri), conf = std::move(conf)]() mutable {
-                    return get_analyzer_configuration(std::move(uri)).then([this, conf = std::move(conf)](auto r) {
-                        auto& [c, _] = r;
-                        conf.provide({
-                            .fm = &m_file_manager,
-                            .libraries = std::move(c.libraries),
-                            .opts = std::move(c.opts),
-                            .pp_opts = std::move(c.pp_opts),
+                    return get_analyzer_configuration(uri).then(
+                        [this, uri = std::move(uri), conf = std::move(conf)](auto r) {
+                            auto& [c, _] = r;
+                            conf.provide({
+                                .fm = &m_file_manager,
+                                .libraries = std::move(c.libraries),
+                                .opts = std::move(c.opts),
+                                .pp_opts = std::move(c.pp_opts),
+                                .macro_caches = m_ws.share_macro_caches(uri),
+                            });
                         });
-                    });
                 }),
                 {},
                 dc_request,
@@ -1168,6 +1216,13 @@ class workspace_manager_impl final : public workspace_manager,
         });
     }
 
+    void memory_usage(workspace_manager_response<std::span<const file_memory_usage>> r) override
+    {
+        handle_request(std::string_view(), std::move(r), [](const auto& resp, auto& ws, const auto&) {
+            resp.provide(ws.memory_usage());
+        });
+    }
+
     [[nodiscard]] utils::value_task<
         std::pair<workspaces::analyzer_configuration, index_t<workspaces::processor_group, unsigned long long>>>
     get_analyzer_configuration(utils::resource::resource_location url) override
@@ -51,6 +51,10 @@ public:
     [[nodiscard]] virtual utils::value_task<std::shared_ptr<file>> add_file(
         const utils::resource::resource_location&) = 0;
 
+    // Adds several files at once, contents that need to be loaded are requested together.
+    [[nodiscard]] virtual utils::value_task<std::vector<std::shared_ptr<file>>> add_files(
+        std::vector<utils::resource::resource_location> file_names) = 0;
+
     // Finds file with specified file name, return nullptr if not found.
     virtual std::shared_ptr<file> find(const utils::resource::resource_location& key) const = 0;
 
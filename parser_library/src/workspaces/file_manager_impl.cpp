@@ -134,6 +134,22 @@ struct file_manager_impl::mapped_file final : file
     }
 };
 
+utils::value_task<std::vector<std::optional<std::string>>> external_file_reader::load_texts(
+    std::vector<utils::resource::resource_location> document_locs) const
+{
+    std::vector<utils::value_task<std::optional<std::string>>> pending;
+    pending.reserve(document_locs.size());
+    for (const auto& loc : document_locs)
+        pending.emplace_back(load_text(loc));
+
+    std::vector<std::optional<std::string>> result;
+    result.reserve(pending.size());
+    for (auto& p : pending)
+        result.emplace_back(co_await std::move(p));
+
+    co_return result;
+}
+
 class : public external_file_reader
 {
     utils::value_task<std::optional<std::string>> load_text(
@@ -221,18 +237,55 @@ utils::value_task<std::shared_ptr<file>> file_manager_impl::add_file(
     }
     return m_file_reader->load_text(file_name).then([this, file_name](auto loaded_text) -> std::shared_ptr<file> {
         std::lock_guard g(files_mutex);
+        return obtain_loaded_file_unsafe(file_name, loaded_text);
+    });
+}
 
-        if (auto result = try_obtaining_file_unsafe(file_name, &loaded_text))
-            return result;
+utils::value_task<std::vector<std::shared_ptr<file>>> file_manager_impl::add_files(
+    std::vector<utils::resource::resource_location> file_names)
+{
+    std::vector<std::shared_ptr<file>> result(file_names.size());
+    std::vector<utils::resource::resource_location> to_load;
+    std::vector<size_t> to_load_idx;
+    {
+        std::lock_guard g(files_mutex);
 
-        auto result = loaded_text.has_value()
-            ? make_mapped_file(file_name, *this, loaded_text.value(), m_text_convertor)
-            : make_mapped_file(file_name, *this, mapped_file::file_error());
+        for (size_t i = 0; i < file_names.size(); ++i)
+        {
+            if (auto f = try_obtaining_file_unsafe(file_names[i], nullptr))
+                result[i] = std::move(f);
+            else
+            {
+                to_load.emplace_back(file_names[i]);
+                to_load_idx.emplace_back(i);
+            }
+        }
+    }
 
-        result->m_it = m_files.try_emplace(file_name, result.get()).first;
+    if (!to_load.empty())
+    {
+        const auto loaded_texts = co_await m_file_reader->load_texts(to_load);
+
+        std::lock_guard g(files_mutex);
+        for (size_t j = 0; j < to_load.size(); ++j)
+            result[to_load_idx[j]] = obtain_loaded_file_unsafe(to_load[j], loaded_texts[j]);
+    }
+
+    co_return result;
+}
 
+std::shared_ptr<file_manager_impl::mapped_file> file_manager_impl::obtain_loaded_file_unsafe(
+    const utils::resource::resource_location& file_name, const std::optional<std::string>& loaded_text)
+{
+    if (auto result = try_obtaining_file_unsafe(file_name, &loaded_text))
         return result;
-    });
+
+    auto result = loaded_text.has_value() ? make_mapped_file(file_name, *this, loaded_text.value(), m_text_convertor)
+                                          : make_mapped_file(file_name, *this, mapped_file::file_error());
+
+    result->m_it = m_files.try_emplace(file_name, result.get()).first;
+
+    return result;
 }
 
 std::shared_ptr<file_manager_impl::mapped_file> file_manager_impl::try_obtaining_file_unsafe(
@@ -36,6 +36,10 @@ class external_file_reader
 public:
     [[nodiscard]] virtual utils::value_task<std::optional<std::string>> load_text(
         const utils::resource::resource_location& document_loc) const = 0;
+    // Loads several files. The default implementation obtains all load_text tasks before awaiting the first one, so
+    // readers that send their requests when the task is created have them in flight together.
+    [[nodiscard]] virtual utils::value_task<std::vector<std::optional<std::string>>> load_texts(
+        std::vector<utils::resource::resource_location> document_locs) const;
     [[nodiscard]] virtual utils::value_task<list_directory_result> list_directory_files(
         const utils::resource::resource_location& directory) const = 0;
     [[nodiscard]] virtual utils::value_task<list_directory_result> list_directory_subdirs_and_symlinks(
@@ -63,6 +67,8 @@ public:
     ~file_manager_impl();
 
     [[nodiscard]] utils::value_task<std::shared_ptr<file>> add_file(const utils::resource::resource_location&) override;
+    [[nodiscard]] utils::value_task<std::vector<std::shared_ptr<file>>> add_files(
+        std::vector<utils::resource::resource_location> file_names) override;
 
     std::shared_ptr<file> find(const utils::resource::resource_location& key) const override;
 
@@ -127,6 +133,8 @@ private:
 
     std::shared_ptr<mapped_file> try_obtaining_file_unsafe(
         const utils::resource::resource_location& file_name, const std::optional<std::string>* expected_text);
+    std::shared_ptr<mapped_file> obtain_loaded_file_unsafe(
+        const utils::resource::resource_location& file_name, const std::optional<std::string>& loaded_text);
 
 protected:
     const auto& get_files() const { return m_files; }
@@ -22,6 +22,7 @@
 #include "file.h"
 #include "file_manager.h"
 #include "lsp/lsp_context.h"
+#include "utils/memory_usage.h"
 
 namespace hlasm_plugin::parser_library::workspaces {
 
@@ -94,15 +95,21 @@ std::optional<std::vector<std::shared_ptr<file>>> macro_cache::load_from_cache(
             lsp::macro_info_ptr info = std::get<lsp::macro_info_ptr>(cached_data->cached_member);
             if (!info)
                 return result; // The file for which the analyzer is cached does not contain definition of macro
+
+            for (const auto& copy_ptr : info->macro_definition->used_copy_members)
+            {
+                if (!locs.emplace_back(file_mngr_->find(copy_ptr->definition_location.resource_loc)))
+                    return std::nullopt; // The dependency was closed in the meantime
+            }
+
             ctx.hlasm_ctx->add_macro(info->macro_definition, info->external);
             ctx.lsp_ctx->add_macro(info, lsp::text_data_view(macro_file_->get_converted_text()));
 
             // Add all copy members on which this macro is dependant
-            for (const auto& copy_ptr : info->macro_definition->used_copy_members)
+            for (auto file = locs.begin(); const auto& copy_ptr : info->macro_definition->used_copy_members)
             {
-                const auto& file = locs.emplace_back(file_mngr_->find(copy_ptr->definition_location.resource_loc));
                 ctx.hlasm_ctx->add_copy_member(copy_ptr);
-                ctx.lsp_ctx->add_copy(copy_ptr, lsp::text_data_view(file->get_converted_text()));
+                ctx.lsp_ctx->add_copy(copy_ptr, lsp::text_data_view((*file++)->get_converted_text()));
             }
         }
         else if (key.kind == processing::processing_kind::COPY)
@@ -152,4 +159,64 @@ void macro_cache::save_macro(const macro_cache_key& key, const analyzer& analyze
         cache_data.cached_member = analyzer.context().hlasm_ctx->get_copy_member(key.name);
 }
 
+macro_cache macro_cache::clone() const
+{
+    macro_cache result(*file_mngr_, macro_file_);
+
+    std::unordered_map<const context::copy_member*, context::copy_member_ptr> copies;
+    const auto clone_copy = [&copies](const context::copy_member_ptr& copy) {
+        auto& cloned = copies[copy.get()];
+        if (!cloned)
+            cloned = std::make_shared<context::copy_member>(*copy);
+        return cloned;
+    };
+
+    for (const auto& [key, data] : cache_)
+    {
+        auto& cloned = result.cache_.try_emplace(key, macro_cache_data { data.stamps, {} }).first->second;
+        if (const auto* mi = std::get_if<lsp::macro_info_ptr>(&data.cached_member); mi && *mi)
+        {
+            auto info = std::make_shared<lsp::macro_info>(**mi);
+            if (const auto& def = info->macro_definition)
+            {
+                std::unordered_set<context::copy_member_ptr> used_copy_members;
+                for (const auto& copy : def->used_copy_members)
+                    used_copy_members.insert(clone_copy(copy));
+                info->macro_definition =
+                    std::make_shared<context::macro_definition>(*def, std::move(used_copy_members));
+            }
+            cloned.cached_member = std::move(info);
+        }
+        else if (const auto* cm = std::get_if<context::copy_member_ptr>(&data.cached_member); cm && *cm)
+            cloned.cached_member = clone_copy(*cm);
+        else
+            cloned.cached_member = data.cached_member;
+    }
+
+    return result;
+}
+
+size_t macro_cache::memory_usage() const noexcept
+{
+    using namespace utils::memory_usage;
+
+    size_t result = sizeof(*this) + nodes(cache_);
+    for (const auto& [key, data] : cache_)
+    {
+        result += heap(key.opsyn_state) + nodes(data.stamps);
+        if (const auto* mi = std::get_if<lsp::macro_info_ptr>(&data.cached_member); mi && *mi)
+        {
+            const auto& info = **mi;
+            result += sizeof(info) + heap(info.var_definitions) + nodes(info.file_occurrences);
+            for (const auto& [_, o] : info.file_occurrences)
+                result += heap(o.symbols) + heap(o.line_details);
+            if (info.macro_definition)
+                result += info.macro_definition->memory_usage();
+        }
+        else if (const auto* cm = std::get_if<context::copy_member_ptr>(&data.cached_member); cm && *cm)
+            result += (*cm)->memory_usage();
+    }
+    return result;
+}
+
 } // namespace hlasm_plugin::parser_library::workspaces
@@ -125,6 +125,12 @@ public:
     std::optional<std::vector<std::shared_ptr<file>>> load_from_cache(
         const macro_cache_key& key, const analyzing_context& ctx) const;
     void save_macro(const macro_cache_key& key, const analyzer& analyzer);
+    // Creates a copy of the cache with duplicated statement caches of the cached members, so that the copy can be
+    // used by an analysis running concurrently with the ones using this cache
+    [[nodiscard]] macro_cache clone() const;
+
+    // approximate number of bytes held by the cached macros and copy members
+    size_t memory_usage() const noexcept;
 
 private:
     [[nodiscard]] const macro_cache_data* find_cached_data(const macro_cache_key& key) const;
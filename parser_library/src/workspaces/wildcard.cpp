@@ -48,6 +48,83 @@ const std::string single_url_char_matcher = []() {
 
     return "(?:[^%//]|" + utf_8_char_matcher + ")";
 }();
+
+int upper_hex(char c) noexcept
+{
+    if (c >= '0' && c <= '9')
+        return c - '0';
+    if (c >= 'A' && c <= 'F')
+        return c - 'A' + 10;
+    return -1;
+}
+
+// value of the percent encoded octet at the start of the string, -1 when there is none
+int encoded_octet(std::string_view s) noexcept
+{
+    if (s.size() < 3 || s[0] != '%')
+        return -1;
+    const auto h = upper_hex(s[1]);
+    const auto l = upper_hex(s[2]);
+    if (h < 0 || l < 0)
+        return -1;
+    return h * 16 + l;
+}
+
+// length of the prefix matched by single_url_char_matcher, 0 when there is no match
+size_t url_char_length(std::string_view s) noexcept
+{
+    if (s.empty() || s.front() == '/')
+        return 0;
+    if (s.front() != '%')
+        return 1;
+
+    const auto lead = encoded_octet(s);
+    int second_min = 0x80;
+    int second_max = 0xBF;
+    size_t octets = 0;
+    if (lead < 0)
+        return 0;
+    else if (lead < 0x80)
+        return 3;
+    else if (lead >= 0xC2 && lead <= 0xDF)
+        octets = 2;
+    else if (lead == 0xE0)
+    {
+        octets = 3;
+        second_min = 0xA0;
+    }
+    else if (lead == 0xED)
+    {
+        octets = 3;
+        second_max = 0x9F;
+    }
+    else if (lead >= 0xE1 && lead <= 0xEF && lead != 0xEE)
+        octets = 3;
+    else if (lead == 0xF0)
+    {
+        octets = 4;
+        second_min = 0x90;
+    }
+    else if (lead >= 0xF1 && lead <= 0xF3)
+        octets = 4;
+    else if (lead == 0xF4)
+    {
+        octets = 4;
+        second_max = 0x8F;
+    }
+    else
+        return 0;
+
+    if (s.size() < 3 * octets)
+        return 0;
+    for (size_t i = 1; i < octets; ++i)
+    {
+        const auto b = encoded_octet(s.substr(3 * i));
+        if (b < (i == 1 ? second_min : 0x80) || b > (i == 1 ? second_max : 0xBF))
+            return 0;
+    }
+    return 3 * octets;
+}
 } // namespace
 
 std::regex wildcard2regex(std::string wildcard)
@@ -135,4 +212,118 @@ std::regex percent_encoded_pathmask_to_regex(std::string_view s)
     return std::regex(r);
 }
 
+pathmask_matcher::pathmask_matcher(std::string_view s)
+{
+    const auto push = [this](token_kind kind, char c = 0) { m_tokens.push_back({ kind, c }); };
+
+    bool path_started = false;
+    while (!s.empty())
+    {
+        switch (const auto c = s.front())
+        {
+            case '*':
+                if (s.starts_with("**/"))
+                {
+                    if (path_started)
+                    {
+                        path_started = false;
+                        push(token_kind::segment);
+                        push(token_kind::literal, '/');
+                    }
+                    m_tokens.push_back({ token_kind::optional, 0, 2 });
+                    push(token_kind::any);
+                    push(token_kind::literal, '/');
+                    s.remove_prefix(3);
+                }
+                else if (s.starts_with("**"))
+                {
+                    push(token_kind::any);
+                    s.remove_prefix(2);
+                }
+                else if (s.starts_with("*/"))
+                {
+                    path_started = false;
+                    push(token_kind::segment);
+                    push(token_kind::literal, '/');
+                    s.remove_prefix(2);
+                }
+                else
+                {
+                    push(token_kind::segment);
+                    s.remove_prefix(1);
+                }
+                break;
+
+            case '/':
+                path_started = false;
+                push(token_kind::literal, c);
+                s.remove_prefix(1);
+                break;
+
+            case '?':
+                path_started = true;
+                push(token_kind::url_char);
+                s.remove_prefix(1);
+                break;
+
+            default:
+                path_started = true;
+                push(token_kind::literal, c);
+                s.remove_prefix(1);
+                break;
+        }
+    }
+}
+
+bool pathmask_matcher::operator()(std::string_view s) const
+{
+    // reach[i * states + j] - the first j tokens can match the first i characters
+    const size_t states = m_tokens.size() + 1;
+    std::vector<unsigned char> reach((s.size() + 1) * states);
+    reach[0] = 1;
+
+    for (size_t i = 0; i <= s.size(); ++i)
+    {
+        auto* const r = reach.data() + i * states;
+        const bool more = i < s.size();
+        // epsilon transitions only lead forward, so a single pass is sufficient
+        for (size_t j = 0; j < m_tokens.size(); ++j)
+        {
+            if (!r[j])
+                continue;
+            switch (const auto& t = m_tokens[j]; t.kind)
+            {
+                case token_kind::literal:
+                    if (more && s[i] == t.c)
+                        r[states + j + 1] = 1;
+                    break;
+
+                case token_kind::url_char:
+                    if (const auto l = url_char_length(s.substr(i)))
+                        r[l * states + j + 1] = 1;
+                    break;
+
+                case token_kind::segment:
+                    r[j + 1] = 1;
+                    if (more && s[i] != '/')
+                        r[states + j] = 1;
+                    break;
+
+                case token_kind::any:
+                    r[j + 1] = 1;
+                    if (more)
+                        r[states + j] = 1;
+                    break;
+
+                case token_kind::optional:
+                    r[j + 1] = 1;
+                    r[j + 1 + t.length] = 1;
+                    break;
+            }
+        }
+    }
+
+    return reach.back() != 0;
+}
+
 } // namespace hlasm_plugin::parser_library::workspaces
@@ -18,12 +18,42 @@
 #include <regex>
 #include <string>
 #include <string_view>
+#include <vector>
 
 namespace hlasm_plugin::parser_library::workspaces {
 // Returns a regex that can be used for wildcard matching.
 std::regex wildcard2regex(std::string wildcard);
 std::regex percent_encoded_pathmask_to_regex(std::string_view s);
 
+// Compiled form of the percent encoded path mask, matches the same language as percent_encoded_pathmask_to_regex
+// without backtracking.
+class pathmask_matcher
+{
+public:
+    explicit pathmask_matcher(std::string_view mask);
+
+    bool operator()(std::string_view s) const;
+
+private:
+    enum class token_kind : unsigned char
+    {
+        literal, // single character
+        url_char, // '?' - single percent encoded UTF-8 character
+        segment, // '*' - any sequence without '/'
+        any, // '**' - any sequence
+        optional, // the following `length` tokens may be skipped
+    };
+
+    struct token
+    {
+        token_kind kind;
+        char c = 0;
+        unsigned char length = 0;
+    };
+
+    std::vector<token> m_tokens;
+};
+
 } // namespace hlasm_plugin::parser_library::workspaces
 
 #endif
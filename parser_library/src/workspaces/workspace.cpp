@@ -18,12 +18,14 @@
 #include <cassert>
 #include <map>
 #include <memory>
+#include <set>
 #include <unordered_set>
 
 #include "analyzer.h"
 #include "completion_item.h"
 #include "completion_trigger_kind.h"
 #include "context/hlasm_context.h"
+#include "context/id_storage.h"
 #include "document_symbol_item.h"
 #include "fade_messages.h"
 #include "file.h"
@@ -41,6 +43,7 @@
 #include "utils/bk_tree.h"
 #include "utils/factory.h"
 #include "utils/levenshtein_distance.h"
+#include "utils/memory_usage.h"
 #include "utils/path_conversions.h"
 #include "utils/projectors.h"
 #include "utils/transform_inserter.h"
@@ -84,6 +87,8 @@ struct workspace::processor_file_compoments
     {}
 
     [[nodiscard]] utils::task update_source_if_needed(file_manager& fm);
+
+    memory_metrics memory_usage() const;
 };
 
 struct parsing_results
@@ -156,6 +161,47 @@ struct parsing_results
     co_return result;
 }
 
+namespace {
+size_t diagnostics_memory_usage(const std::vector<diagnostic>& diags) noexcept
+{
+    using utils::memory_usage::heap;
+    size_t result = heap(diags);
+    for (const auto& d : diags)
+    {
+        result += heap(d.file_uri) + heap(d.code) + heap(d.message) + heap(d.related);
+        for (const auto& r : d.related)
+            result += heap(r.location.uri) + heap(r.message);
+    }
+    return result;
+}
+} // namespace
+
+memory_metrics workspace::processor_file_compoments::memory_usage() const
+{
+    using utils::memory_usage::heap;
+
+    memory_metrics result;
+
+    const auto& r = *m_last_results;
+    result.hl_info = heap(r.hl_info);
+    if (r.lsp_context)
+        result.lsp_context = r.lsp_context->memory_usage();
+    result.diagnostics =
+        diagnostics_memory_usage(r.opencode_diagnostics) + diagnostics_memory_usage(r.macro_diagnostics);
+    result.outputs = heap(r.outputs);
+    for (const auto& o : r.outputs)
+        result.outputs += heap(o.text);
+
+    for (const auto& [_, dep] : m_dependencies)
+        if (const auto* cache = std::get_if<std::shared_ptr<dependency_cache>>(&dep))
+            result.macro_cache += (*cache)->cache.memory_usage();
+
+    if (m_last_opencode_id_storage)
+        result.id_storage = m_last_opencode_id_storage->memory_usage();
+
+    return result;
+}
+
 struct workspace_parse_lib_provider final : public parse_lib_provider
 {
     file_manager& fm;
@@ -310,6 +356,41 @@ struct workspace_parse_lib_provider final : public parse_lib_provider
             co_return std::make_pair((co_await get_file(url))->get_converted_text(), std::move(url));
     }
 
+    // Files used by the previous analysis are likely to be needed again. Members are also resolved through the
+    // current library listings, which may point to new locations. Files that are not held open are requested together
+    // instead of one by one as the analysis reaches them.
+    [[nodiscard]] utils::task prefetch_dependencies()
+    {
+        std::set<resource_location> predicted;
+        const auto predict = [this, &predicted](const resource_location& url) {
+            if (!url.empty() && !fm.find(url))
+                predicted.insert(url);
+        };
+
+        for (const auto& [url, dep] : pfc.m_dependencies)
+        {
+            if (std::holds_alternative<std::shared_ptr<workspace::dependency_cache>>(dep))
+                predict(url);
+        }
+        for (const auto& [member, _] : pfc.m_member_map)
+        {
+            resource_location url;
+            if (std::ranges::any_of(libraries, [&member, &url](const auto& lib) { return lib->has_file(member, &url); }))
+                predict(url);
+        }
+
+        if (predicted.size() < 2)
+            return {};
+
+        std::vector<resource_location> urls(predicted.begin(), predicted.end());
+        return fm.add_files(urls).then([this, urls](auto files) {
+            // failed loads are left to be retried individually by the analysis
+            for (size_t i = 0; i < files.size(); ++i)
+                if (!files[i]->error())
+                    current_file_map.try_emplace(urls[i], std::move(files[i]));
+        });
+    }
+
     [[nodiscard]] utils::task prefetch_libraries() const
     {
         std::vector<utils::task> pending_prefetches;
@@ -554,11 +635,8 @@ std::vector<const workspace::processor_file_compoments*> workspace::find_related
     if (auto f = find_processor_file_impl(document_loc); f)
         opencodes.push_back(f);
 
-    for (const auto& [_, component] : m_processor_files)
-    {
-        if (component.m_dependencies.contains(document_loc))
-            opencodes.push_back(&component);
-    }
+    if (const auto* dependants = find_dependants(document_loc))
+        opencodes.insert(opencodes.end(), dependants->begin(), dependants->end());
 
     return opencodes;
 }
@@ -612,6 +690,8 @@ utils::value_task<parse_file_result> workspace::parse_file(resource_location* se
 
         if (auto prefetch = ws_lib.prefetch_libraries(); prefetch.valid())
             co_await std::move(prefetch);
+        if (auto prefetch = ws_lib.prefetch_dependencies(); prefetch.valid())
+            co_await std::move(prefetch);
 
         bool collect_perf_metrics = comp.m_collect_perf_metrics;
 
@@ -650,6 +730,7 @@ utils::value_task<parse_file_result> workspace::parse_file(resource_location* se
                                                       : std::optional<performance_metrics>(),
             .errors = errors,
             .warnings = warnings,
+            .memory = collect_perf_metrics ? comp.memory_usage() : memory_metrics(),
             .outputs_changed = outputs_changed,
         };
     }(comp, *this);
@@ -678,12 +759,11 @@ utils::task workspace::mark_file_for_parsing(
 
     if (file_content_status == file_content_state::changed_content && trigger_reparse(file_location))
     {
-        for (auto& [_, component] : m_processor_files)
+        if (const auto* dependants = find_dependants(file_location))
         {
-            if (!component.m_opened)
-                continue;
-            if (component.m_dependencies.contains(file_location))
-                m_parsing_pending.emplace(component.m_file->get_location());
+            for (const auto* component : *dependants)
+                if (component->m_opened)
+                    m_parsing_pending.emplace(component->m_file->get_location());
         }
     }
 
@@ -728,8 +808,10 @@ workspace_file_info workspace::parse_successful(processor_file_compoments& comp,
 
     ws_file_info.files_processed = libs.next_dependencies.size() + 1; // TODO: identify error states?
 
+    unregister_dependencies(comp);
     comp.m_dependencies = std::move(libs.next_dependencies);
     comp.m_member_map = std::move(libs.next_member_map);
+    register_dependencies(comp);
 
     return ws_file_info;
 }
@@ -756,11 +838,13 @@ utils::task workspace::did_close_file(resource_location file_location)
     bool found_dependency = false;
     // first check whether the file is a dependency
     std::vector<utils::task> pending_updates;
-    for (std::shared_ptr<file> file; const auto& [_, component] : m_processor_files)
+    std::vector<const processor_file_compoments*> dependants;
+    if (const auto* d = find_dependants(file_location))
+        dependants.assign(d->begin(), d->end());
+    for (std::shared_ptr<file> file; const auto* component : dependants)
     {
-        auto it = component.m_dependencies.find(file_location);
-        if (it == component.m_dependencies.end())
-            continue;
+        auto it = component->m_dependencies.find(file_location);
+        assert(it != component->m_dependencies.end());
         if (!std::holds_alternative<std::shared_ptr<dependency_cache>>(it->second))
             continue;
 
@@ -789,6 +873,7 @@ utils::task workspace::did_close_file(resource_location file_location)
     filter_and_close_dependencies(std::move(files_to_close), &fcomp->second);
 
     // close the file itself
+    unregister_dependencies(fcomp->second);
     m_processor_files.erase(fcomp);
 }
 
@@ -942,6 +1027,48 @@ std::vector<output_line> workspace::retrieve_output(const resource_location& doc
     return comp->m_last_results->outputs;
 }
 
+debugging::shared_macro_caches workspace::share_macro_caches(const resource_location& document_loc)
+{
+    debugging::shared_macro_caches result;
+
+    auto it = m_processor_files.find(document_loc);
+    if (it == m_processor_files.end() || !it->second.m_last_opencode_id_storage)
+        return result;
+
+    auto& comp = it->second;
+
+    // Cached members refer to the identifiers of the last analysis, so the storage is frozen and both the workspace
+    // and the macro tracer continue in their own layers. The layer is reused when nothing was added to it since.
+    auto& ids = comp.m_last_opencode_id_storage;
+    std::shared_ptr<const context::id_storage> frozen = ids;
+    if (const auto& base = ids->base(); base && base->size() == ids->size())
+        frozen = base;
+    else
+        ids = std::make_shared<context::id_storage>(frozen);
+
+    result.ids = std::make_shared<context::id_storage>(std::move(frozen));
+
+    for (const auto& [url, dep] : comp.m_dependencies)
+    {
+        if (const auto* cache = std::get_if<std::shared_ptr<dependency_cache>>(&dep))
+            result.caches.try_emplace(url, (*cache)->cache.clone());
+    }
+
+    return result;
+}
+
+std::vector<file_memory_usage> workspace::memory_usage() const
+{
+    std::vector<file_memory_usage> result;
+    result.reserve(m_processor_files.size());
+    for (const auto& [loc, comp] : m_processor_files)
+        result.emplace_back(std::string(loc.get_uri()), comp.memory_usage());
+
+    std::ranges::sort(result, std::ranges::greater(), [](const auto& e) { return e.memory.total(); });
+
+    return result;
+}
+
 std::optional<performance_metrics> workspace::last_metrics(const resource_location& document_loc) const
 {
     auto comp = find_processor_file_impl(document_loc);
@@ -1055,61 +1182,59 @@ std::vector<std::pair<std::string, size_t>> workspace::make_opcode_suggestion(
     return result;
 }
 
-template<bool Multi = false, typename T, typename U, typename Projector = std::identity>
-void erase_ordered(T& from, const U& what, Projector p = Projector())
-{
-    auto f = from.begin();
-    auto w = what.begin();
-    while (f != from.end() && w != what.end())
-    {
-        if (auto c = *f <=> std::invoke(p, *w); c == 0)
-        {
-            f = from.erase(f);
-            if constexpr (!Multi)
-                ++w;
-        }
-        else if (c < 0)
-            f = from.lower_bound(std::invoke(p, *w));
-        else
-            w = what.lower_bound(*f);
-    }
-}
-
 void workspace::filter_and_close_dependencies(
     std::set<resource_location> files_to_close_candidates, const processor_file_compoments* file_to_ignore)
 {
     // filters the files that are dependencies of other dependants and externally open files
-    for (const auto& [_, component] : m_processor_files)
-    {
-        if (files_to_close_candidates.empty())
-            return;
-
-        if (&component == file_to_ignore)
-            continue;
-
-        if (component.m_opened)
-            files_to_close_candidates.erase(component.m_file->get_location());
-
-        erase_ordered(files_to_close_candidates,
-            component.m_dependencies,
-            &decltype(component.m_dependencies)::value_type::first);
-    }
+    std::erase_if(files_to_close_candidates, [this, file_to_ignore](const auto& dep) {
+        if (auto it = m_processor_files.find(dep); it != m_processor_files.end() && it->second.m_opened)
+            return true;
+        const auto* dependants = find_dependants(dep);
+        return dependants && std::ranges::any_of(*dependants, [file_to_ignore](const auto* d) {
+            return d != file_to_ignore;
+        });
+    });
 
     // close all exclusive dependencies of file
     for (const auto& dep : files_to_close_candidates)
     {
-        m_processor_files.erase(dep);
+        if (auto it = m_processor_files.find(dep); it != m_processor_files.end())
+        {
+            unregister_dependencies(it->second);
+            m_processor_files.erase(it);
+        }
     }
 }
 
 bool workspace::is_dependency(const resource_location& file_location) const
 {
-    for (const auto& [_, component] : m_processor_files)
+    return find_dependants(file_location) != nullptr;
+}
+
+void workspace::register_dependencies(const processor_file_compoments& comp)
+{
+    for (const auto& [dep, _] : comp.m_dependencies)
+        m_dependants[dep].insert(&comp);
+}
+
+void workspace::unregister_dependencies(const processor_file_compoments& comp)
+{
+    for (const auto& [dep, _] : comp.m_dependencies)
     {
-        if (component.m_dependencies.contains(file_location))
-            return true;
+        auto it = m_dependants.find(dep);
+        if (it == m_dependants.end())
+            continue;
+        it->second.erase(&comp);
+        if (it->second.empty())
+            m_dependants.erase(it);
     }
-    return false;
+}
+
+const std::unordered_set<const workspace::processor_file_compoments*>* workspace::find_dependants(
+    const resource_location& file_location) const
+{
+    auto it = m_dependants.find(file_location);
+    return it == m_dependants.end() ? nullptr : &it->second;
 }
 
 utils::task workspace::processor_file_compoments::update_source_if_needed(file_manager& fm)
@@ -66,6 +66,7 @@ struct parse_file_result
     std::optional<performance_metrics> metrics_to_report;
     size_t errors = 0;
     size_t warnings = 0;
+    memory_metrics memory;
     bool outputs_changed = false;
 };
 // Represents a LSP workspace. It solves all dependencies between files -
@@ -118,6 +119,12 @@ public:
 
     std::vector<output_line> retrieve_output(const resource_location& document_loc) const;
 
+    // macro caches of the last analysis of the program, detached for use by the macro tracer
+    debugging::shared_macro_caches share_macro_caches(const resource_location& document_loc);
+
+    // approximate memory held by each analyzed file
+    std::vector<file_memory_usage> memory_usage() const;
+
     std::optional<performance_metrics> last_metrics(const resource_location& document_loc) const;
 
     void set_message_consumer(message_consumer* consumer);
@@ -151,6 +158,13 @@ private:
 
     std::unordered_map<resource_location, processor_file_compoments> m_processor_files;
     std::unordered_set<resource_location> m_parsing_pending;
+    // reverse index of m_dependencies - components that used the file in their last analysis
+    std::unordered_map<resource_location, std::unordered_set<const processor_file_compoments*>> m_dependants;
+
+    void register_dependencies(const processor_file_compoments& comp);
+    void unregister_dependencies(const processor_file_compoments& comp);
+    const std::unordered_set<const processor_file_compoments*>* find_dependants(
+        const resource_location& file_location) const;
 
     [[nodiscard]] utils::value_task<processor_file_compoments&> add_processor_file_impl(std::shared_ptr<file> f);
     const processor_file_compoments* find_processor_file_impl(const resource_location& file) const;
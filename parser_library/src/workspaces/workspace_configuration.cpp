@@ -871,7 +871,7 @@ utils::task workspace_configuration::find_and_add_libs(utils::resource::resource
     library_local_options opts,
     std::vector<diagnostic>& diags)
 {
-    std::regex path_validator = percent_encoded_pathmask_to_regex(path_pattern);
+    const pathmask_matcher path_validator(path_pattern);
 
     std::unordered_set<std::string> processed_canonical_paths;
     std::deque<std::pair<std::string, utils::resource::resource_location>> dirs_to_search;
@@ -884,6 +884,10 @@ utils::task workspace_configuration::find_and_add_libs(utils::resource::resource
     }
 
     constexpr size_t limit = 1000;
+    // directory listings issued before the first one is awaited, remote file systems respond to them in parallel
+    constexpr size_t max_listings_in_flight = 32;
+
+    std::vector<std::pair<utils::resource::resource_location, utils::value_task<list_directory_result>>> listings;
     for (bool first_ = true; !dirs_to_search.empty();)
     {
         const auto first = std::exchange(first_, false);
@@ -894,29 +898,41 @@ utils::task workspace_configuration::find_and_add_libs(utils::resource::resource
             break;
         }
 
-        auto [canonical_path, dir] = std::move(dirs_to_search.front());
-        dirs_to_search.pop_front();
-
-        if (!processed_canonical_paths.insert(std::move(canonical_path)).second)
-            continue;
+        listings.clear();
+        while (!dirs_to_search.empty() && listings.size() < max_listings_in_flight
+            && processed_canonical_paths.size() <= limit)
+        {
+            auto [canonical_path, dir] = std::move(dirs_to_search.front());
+            dirs_to_search.pop_front();
 
-        if (const auto dir_uri = dir.get_uri(); std::regex_match(dir_uri.begin(), dir_uri.end(), path_validator))
-            prc_grp.add_library(get_local_library(dir, opts));
+            if (!processed_canonical_paths.insert(std::move(canonical_path)).second)
+                continue;
 
-        auto [subdir_list, return_code] = co_await m_file_manager.list_directory_subdirs_and_symlinks(dir);
-        if (return_code != utils::path::list_directory_rc::done)
-        {
-            if (!first || !opts.optional_library || return_code != utils::path::list_directory_rc::not_exists)
-                diags.push_back(error_L0001(m_proc_grps_current_loc, dir));
-            break;
+            auto listing = m_file_manager.list_directory_subdirs_and_symlinks(dir);
+            listings.emplace_back(std::move(dir), std::move(listing));
         }
 
-        for (auto& [subdir_canonical_path, subdir] : subdir_list)
+        // results are consumed in the order of the breadth-first search
+        for (auto& [dir, listing] : listings)
         {
-            if (processed_canonical_paths.contains(subdir_canonical_path))
-                continue;
+            if (path_validator(dir.get_uri()))
+                prc_grp.add_library(get_local_library(dir, opts));
 
-            dirs_to_search.emplace_back(std::move(subdir_canonical_path), subdir.lexically_normal());
+            auto [subdir_list, return_code] = co_await std::move(listing);
+            if (return_code != utils::path::list_directory_rc::done)
+            {
+                if (!first || !opts.optional_library || return_code != utils::path::list_directory_rc::not_exists)
+                    diags.push_back(error_L0001(m_proc_grps_current_loc, dir));
+                co_return;
+            }
+
+            for (auto& [subdir_canonical_path, subdir] : subdir_list)
+            {
+                if (processed_canonical_paths.contains(subdir_canonical_path))
+                    continue;
+
+                dirs_to_search.emplace_back(std::move(subdir_canonical_path), subdir.lexically_normal());
+            }
         }
     }
 }
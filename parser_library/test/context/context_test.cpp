@@ -65,6 +65,40 @@ TEST(context_id_storage, case_insensitive)
     ASSERT_TRUE(it1 == it3);
 }
 
+TEST(context_id_storage, memory_usage)
+{
+    id_storage ids;
+
+    const auto empty = ids.memory_usage();
+
+    // short identifiers are stored inline
+    ids.add(std::string_view("SHORT"));
+    EXPECT_EQ(ids.memory_usage(), empty);
+
+    const std::string long_id(100, 'A');
+    ids.add(std::string_view(long_id));
+    EXPECT_GE(ids.memory_usage(), empty + long_id.size());
+}
+
+TEST(context_id_storage, layered)
+{
+    const std::string long_base(20, 'A');
+    const std::string long_layer(20, 'B');
+
+    auto base = std::make_shared<id_storage>();
+    const auto base_id = base->add(std::string_view(long_base));
+
+    id_storage layer(base);
+    EXPECT_EQ(layer.find(long_base), base_id);
+    EXPECT_EQ(layer.add(std::string_view(long_base)), base_id);
+    EXPECT_EQ(base->size(), 1);
+
+    const auto layer_id = layer.add(std::string_view(long_layer));
+    EXPECT_EQ(layer.find(long_layer), layer_id);
+    EXPECT_FALSE(base->find(long_layer).has_value());
+    EXPECT_EQ(layer.size(), 2);
+}
+
 TEST(context, create_global_var)
 {
     hlasm_context ctx;
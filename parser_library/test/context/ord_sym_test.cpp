@@ -547,3 +547,49 @@ X   EQU   1
 
     EXPECT_EQ(get_symbol_abs(a.hlasm_ctx(), "L"), 8);
 }
+
+TEST(ordinary_symbols, long_forward_reference_chain)
+{
+    constexpr int count = 2000;
+    std::string input;
+    for (int i = 0; i < count; ++i)
+        input.append("S").append(std::to_string(i)).append(" EQU S").append(std::to_string(i + 1)).append("+1\n");
+    input.append("S").append(std::to_string(count)).append(" EQU 0\n");
+
+    analyzer a(input);
+    a.analyze();
+
+    EXPECT_TRUE(a.diags().empty());
+
+    EXPECT_EQ(get_symbol_abs(a.hlasm_ctx(), "S0"), count);
+}
+
+TEST(ordinary_symbols, long_backward_reference_chain)
+{
+    constexpr int count = 2000;
+    std::string input;
+    for (int i = count; i > 0; --i)
+        input.append("S").append(std::to_string(i)).append(" EQU S").append(std::to_string(i - 1)).append("+1\n");
+    input.append("S0 EQU 0\n");
+
+    analyzer a(input);
+    a.analyze();
+
+    EXPECT_TRUE(a.diags().empty());
+
+    EXPECT_EQ(get_symbol_abs(a.hlasm_ctx(), std::string("S") + std::to_string(count)), count);
+}
+
+TEST(ordinary_symbols, long_cyclic_reference_chain)
+{
+    constexpr int count = 500;
+    std::string input;
+    for (int i = count; i > 0; --i)
+        input.append("S").append(std::to_string(i)).append(" EQU S").append(std::to_string(i - 1)).append("+1\n");
+    input.append("S0 EQU S").append(std::to_string(count)).append("\n");
+
+    analyzer a(input);
+    a.analyze();
+
+    EXPECT_TRUE(matches_message_codes(a.diags(), { "E033" }));
+}
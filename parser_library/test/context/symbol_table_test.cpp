@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2025 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "context/id_storage.h"
+#include "context/ordinary_assembly/symbol_table.h"
+
+using namespace hlasm_plugin::parser_library::context;
+
+namespace {
+std::vector<id_index> generate_ids(id_storage& ids, size_t n)
+{
+    std::vector<id_index> result;
+    for (size_t i = 0; i < n; ++i)
+        result.push_back(ids.add("SYMBOL_WITH_A_LONG_NAME_" + std::to_string(i)));
+    return result;
+}
+} // namespace
+
+TEST(symbol_table, insert_find)
+{
+    id_storage ids;
+    const auto names = generate_ids(ids, 1000);
+
+    symbol_table<size_t> table;
+    EXPECT_TRUE(table.empty());
+
+    for (size_t i = 0; i < names.size(); ++i)
+    {
+        auto [v, inserted] = table.try_emplace(names[i], i);
+        EXPECT_TRUE(inserted);
+        EXPECT_EQ(v->first, names[i]);
+    }
+    EXPECT_EQ(table.size(), names.size());
+
+    for (size_t i = 0; i < names.size(); ++i)
+    {
+        const auto* v = table.find(names[i]);
+        ASSERT_TRUE(v);
+        EXPECT_EQ(v->second, i);
+    }
+    EXPECT_FALSE(table.find(id_index("MISSING")));
+    EXPECT_FALSE(table.contains(ids.add(std::string_view("NOT_IN_THE_TABLE"))));
+
+    auto [v, inserted] = table.try_emplace(names[5], 0);
+    EXPECT_FALSE(inserted);
+    EXPECT_EQ(v->second, 5);
+}
+
+TEST(symbol_table, stable_addresses)
+{
+    id_storage ids;
+    const auto names = generate_ids(ids, 10000);
+
+    symbol_table<std::string> table;
+    const auto* first = table.try_emplace(names[0], "first").first;
+
+    for (size_t i = 1; i < names.size(); ++i)
+        table.try_emplace(names[i], std::to_string(i));
+
+    EXPECT_EQ(table.find(names[0]), first);
+    EXPECT_EQ(first->second, "first");
+
+    const auto [assigned, inserted] = table.insert_or_assign(names[0], "reassigned");
+    EXPECT_FALSE(inserted);
+    EXPECT_EQ(assigned, first);
+    EXPECT_EQ(first->second, "reassigned");
+}
+
+TEST(symbol_table, erase)
+{
+    id_storage ids;
+    const auto names = generate_ids(ids, 100);
+
+    symbol_table<size_t> table;
+    for (size_t i = 0; i < names.size(); ++i)
+        table.try_emplace(names[i], i);
+
+    for (size_t i = 0; i < names.size(); i += 2)
+        EXPECT_EQ(table.erase(names[i]), 1);
+    EXPECT_EQ(table.erase(names[0]), 0);
+    EXPECT_EQ(table.size(), names.size() / 2);
+
+    for (size_t i = 0; i < names.size(); ++i)
+        EXPECT_EQ(table.contains(names[i]), i % 2 == 1);
+
+    // erased entries are reused and tombstones do not break probing
+    for (int round = 0; round < 10; ++round)
+    {
+        for (size_t i = 0; i < names.size(); i += 2)
+            EXPECT_TRUE(table.insert_or_assign(names[i], i).second);
+        for (size_t i = 0; i < names.size(); i += 2)
+            EXPECT_EQ(table.erase(names[i]), 1);
+    }
+    EXPECT_EQ(table.size(), names.size() / 2);
+    for (size_t i = 1; i < names.size(); i += 2)
+        EXPECT_EQ(table.find(names[i])->second, i);
+}
+
+TEST(symbol_table, iteration)
+{
+    id_storage ids;
+    const auto names = generate_ids(ids, 200);
+
+    symbol_table<size_t> table;
+    EXPECT_EQ(table.begin(), table.end());
+
+    for (size_t i = 0; i < names.size(); ++i)
+        table.try_emplace(names[i], i);
+    for (size_t i = 0; i < names.size(); i += 3)
+        table.erase(names[i]);
+
+    std::vector<size_t> visited;
+    for (const auto& [name, value] : std::as_const(table))
+    {
+        EXPECT_EQ(name, names[value]);
+        visited.push_back(value);
+    }
+
+    std::vector<size_t> expected;
+    for (size_t i = 0; i < names.size(); ++i)
+        if (i % 3 != 0)
+            expected.push_back(i);
+
+    EXPECT_EQ(visited, expected);
+}
@@ -21,9 +21,14 @@
 #include "../workspace/file_manager_mock.h"
 #include "../workspace/library_mock.h"
 #include "analyzer.h"
+#include "context/hlasm_context.h"
+#include "context/id_storage.h"
 #include "debugging/debug_lib_provider.h"
+#include "lsp/lsp_context.h"
 #include "utils/resource_location.h"
 #include "utils/task.h"
+#include "workspaces/file.h"
+#include "workspaces/file_manager_impl.h"
 
 using namespace ::testing;
 using namespace hlasm_plugin::parser_library;
@@ -89,3 +94,42 @@ TEST_F(debug_lib_provider_test, get_library)
 
     EXPECT_EQ(lib.get_library("BBB").run().value(), std::nullopt);
 }
+
+TEST(debug_lib_provider, shared_macro_cache)
+{
+    const resource_location mac_location("MAC");
+    file_manager_impl fm;
+    fm.did_open_file(mac_location, 0, " MACRO\n MAC\n MNOTE 'CACHED'\n MEND");
+
+    auto ids = std::make_shared<context::id_storage>();
+    auto hlasm_ctx = std::make_shared<context::hlasm_context>(resource_location("OPENCODE"), asm_option(), ids);
+    analyzing_context ctx { hlasm_ctx, std::make_shared<lsp::lsp_context>(hlasm_ctx) };
+
+    analyzer macro_analyzer(fm.find(mac_location)->get_converted_text(),
+        analyzer_options {
+            mac_location,
+            ctx,
+            analyzer_options::dependency("MAC", processing::processing_kind::MACRO),
+        });
+    macro_analyzer.analyze();
+
+    constexpr context::id_index mac_id("MAC");
+
+    std::unordered_map<resource_location, macro_cache> caches;
+    caches.try_emplace(mac_location, fm, fm.find(mac_location))
+        .first->second.save_macro(
+            macro_cache_key::create_from_context(*hlasm_ctx, processing::processing_kind::MACRO, mac_id),
+            macro_analyzer);
+
+    auto mock_lib = std::make_shared<NiceMock<library_mock>>();
+    EXPECT_CALL(*mock_lib, has_file(Eq("MAC"), _))
+        .WillRepeatedly(DoAll(SetArgPointee<1>(mac_location), Return(true)));
+
+    debug_lib_provider lib({ mock_lib }, fm, std::move(caches));
+
+    analyzer a(" MAC", analyzer_options(&lib, std::make_shared<context::id_storage>(ids)));
+    a.co_analyze().run();
+
+    EXPECT_TRUE(matches_message_codes(a.diags(), { "MNOTE" }));
+    EXPECT_EQ(a.hlasm_ctx().get_macro_definition(mac_id), hlasm_ctx->get_macro_definition(mac_id));
+}
@@ -1238,6 +1238,150 @@ TEST(debugger, breakpoints_set_get)
 
     ASSERT_EQ(bps.size(), 1);
     EXPECT_EQ(bp.line, bps.begin()->line);
+
+    d.breakpoints("file", {});
+    EXPECT_TRUE(d.breakpoints("file").empty());
+}
+
+TEST(debugger, run_to_breakpoint)
+{
+    std::string open_code = R"(
+    MACRO
+    MAC
+    LR 1,1
+    MEND
+&I  SETA 0
+.L  ANOP
+&I  SETA &I+1
+    MAC
+    AIF (&I LT 3).L
+    LR 2,2
+)";
+
+    file_manager_impl file_manager;
+    NiceMock<debugger_configuration_provider_mock> dc_provider;
+    EXPECT_CALL(dc_provider, provide_debugger_configuration).WillRepeatedly(Invoke([&file_manager](auto, auto r) {
+        r.provide({ .fm = &file_manager });
+    }));
+    debugger d;
+    debug_event_consumer_s_mock m(d);
+
+    const resource_location file_loc("test");
+
+    file_manager.did_open_file(file_loc, 0, open_code);
+
+    breakpoint bps[] = { breakpoint(3), breakpoint(1000) };
+    d.breakpoints(file_loc.get_uri(), bps);
+
+    auto [resp, mock] = make_workspace_manager_response(std::in_place_type<workspace_manager_response_mock<bool>>);
+    EXPECT_CALL(*mock, provide(true));
+    d.launch(file_loc.get_uri(), dc_provider, false, resp);
+
+    // the macro is invoked three times
+    for (int i = 0; i < 3; ++i)
+    {
+        if (i > 0)
+            d.continue_debug();
+        m.wait_for_stopped();
+        EXPECT_EQ(m.get_last_reason(), "breakpoint");
+        auto frames = d.stack_frames();
+        ASSERT_EQ(frames.size(), 2U);
+        EXPECT_EQ(frames[0].begin_line, 3U);
+    }
+
+    d.breakpoints(file_loc.get_uri(), {});
+    breakpoint last(10);
+    d.breakpoints(file_loc.get_uri(), std::span(&last, 1));
+    d.continue_debug();
+
+    m.wait_for_stopped();
+    auto frames = d.stack_frames();
+    ASSERT_EQ(frames.size(), 1U);
+    EXPECT_EQ(frames[0].begin_line, 10U);
+
+    d.continue_debug();
+    m.wait_for_exited();
+}
+
+TEST(debugger, step_back_and_restart)
+{
+    std::string open_code = R"(
+    MACRO
+    MAC
+    LR 1,1
+    MNOTE 'INSIDE'
+    MEND
+    LR 2,2
+    MAC
+    LR 3,3
+    MAC
+)";
+
+    file_manager_impl file_manager;
+    NiceMock<debugger_configuration_provider_mock> dc_provider;
+    EXPECT_CALL(dc_provider, provide_debugger_configuration).WillRepeatedly(Invoke([&file_manager](auto, auto r) {
+        r.provide({ .fm = &file_manager });
+    }));
+    debugger d;
+    debug_event_consumer_s_mock m(d);
+
+    const resource_location file_loc("test");
+
+    file_manager.did_open_file(file_loc, 0, open_code);
+
+    breakpoint bp(3);
+    d.breakpoints(file_loc.get_uri(), std::span(&bp, 1));
+
+    auto [resp, mock] = make_workspace_manager_response(std::in_place_type<workspace_manager_response_mock<bool>>);
+    EXPECT_CALL(*mock, provide(true));
+    d.launch(file_loc.get_uri(), dc_provider, true, resp);
+
+    const auto current_line = [&d]() {
+        auto frames = d.stack_frames();
+        return frames.empty() ? (size_t)-1 : frames[0].begin_line;
+    };
+
+    m.wait_for_stopped();
+    EXPECT_EQ(current_line(), 1U);
+
+    // stops in both macro invocations
+    d.continue_debug();
+    m.wait_for_stopped();
+    EXPECT_EQ(current_line(), 3U);
+    EXPECT_EQ(d.stack_frames().size(), 2U);
+    d.continue_debug();
+    m.wait_for_stopped();
+    EXPECT_EQ(current_line(), 3U);
+    d.step_in();
+    m.wait_for_stopped();
+    EXPECT_EQ(current_line(), 4U);
+    EXPECT_EQ(m.get_last_mnote().second, "INSIDE");
+
+    d.step_back();
+    m.wait_for_stopped();
+    EXPECT_EQ(current_line(), 3U);
+    EXPECT_EQ(d.stack_frames().size(), 2U);
+
+    d.step_back();
+    m.wait_for_stopped();
+    EXPECT_EQ(current_line(), 9U);
+    EXPECT_EQ(d.stack_frames().size(), 1U);
+
+    d.reverse_continue();
+    m.wait_for_stopped();
+    EXPECT_EQ(current_line(), 3U);
+    EXPECT_EQ(d.stack_frames()[1].begin_line, 7U);
+
+    d.restart();
+    m.wait_for_stopped();
+    EXPECT_EQ(current_line(), 1U);
+
+    d.continue_debug();
+    m.wait_for_stopped();
+    EXPECT_EQ(current_line(), 3U);
+    EXPECT_EQ(d.stack_frames()[1].begin_line, 7U);
+
+    d.disconnect();
 }
 
 TEST(debugger, function_breakpoints)
@@ -48,7 +48,9 @@ std::ostream& operator<<(std::ostream& stream, const performance_metrics& item)
                   << "\n macro statements: " << item.macro_statements
                   << "\n non continued statements: " << item.non_continued_statements
                   << "\n open code statements: " << item.open_code_statements
-                  << "\n reparsed statements: " << item.reparsed_statements << "\n";
+                  << "\n reparsed statements: " << item.reparsed_statements
+                  << "\n using evaluations: " << item.using_evaluations
+                  << "\n using evaluation cache hits: " << item.using_evaluation_cache_hits << "\n";
 }
 
 } // namespace hlasm_plugin::parser_library
@@ -73,6 +73,61 @@ TEST(lsp_completion, completion_list_instr_exact)
         std::ranges::any_of(result, [](const auto& e) { return e.label == "AAAA" && e.suggestion_for.empty(); }));
 }
 
+TEST(lsp_completion, completion_list_instr_filtered)
+{
+    const std::string input = R"(
+    MACRO
+    MYMAC
+    MEND
+)";
+    analyzer a(input);
+    a.analyze();
+
+    const auto& m = a.context().lsp_ctx->macros();
+    const auto has = [](const auto& result, std::string_view label) {
+        return std::ranges::any_of(result, [label](const auto& e) { return e.label == label; });
+    };
+
+    auto prefix = lsp::generate_completion(
+        lsp::completion_list_source(lsp::completion_list_instructions { "mv", 1, &m, a.context().lsp_ctx.get(), {} }),
+        nullptr);
+    EXPECT_TRUE(has(prefix, "MVC"));
+    EXPECT_FALSE(has(prefix, "MYMAC"));
+    EXPECT_FALSE(has(prefix, "LR"));
+    EXPECT_TRUE(std::ranges::all_of(prefix, [](const auto& e) { return e.label.front() == 'M'; }));
+
+    auto fuzzy = lsp::generate_completion(
+        lsp::completion_list_source(lsp::completion_list_instructions { "MC", 1, &m, a.context().lsp_ctx.get(), {} }),
+        nullptr);
+    EXPECT_TRUE(has(fuzzy, "MVC"));
+    EXPECT_TRUE(has(fuzzy, "MYMAC"));
+    EXPECT_FALSE(has(fuzzy, "MVI"));
+
+    auto all = lsp::generate_completion(
+        lsp::completion_list_source(lsp::completion_list_instructions { "", 1, &m, a.context().lsp_ctx.get(), {} }),
+        nullptr);
+    EXPECT_TRUE(has(all, "LR"));
+    EXPECT_TRUE(has(all, "MVC"));
+    EXPECT_TRUE(has(all, "MYMAC"));
+    EXPECT_GT(all.size(), prefix.size());
+}
+
+TEST(lsp_completion, completion_list_instr_suggestion_other_letter)
+{
+    analyzer a("");
+    a.analyze();
+
+    const auto& m = a.context().lsp_ctx->macros();
+
+    auto result = lsp::generate_completion(lsp::completion_list_source(lsp::completion_list_instructions {
+                                               "XVC", 1, &m, a.context().lsp_ctx.get(), { "MVC" } }),
+        nullptr);
+
+    EXPECT_EQ(std::ranges::count(result, "MVC", &completion_item::label), 1);
+    EXPECT_TRUE(
+        std::ranges::any_of(result, [](const auto& e) { return e.label == "MVC" && e.suggestion_for == "XVC"; }));
+}
+
 TEST(lsp_completion, completion_list_vars)
 {
     lsp::vardef_storage vars(1, lsp::variable_symbol_definition(context::id_index("VARNAME"), zero_stmt_id, {}));
@@ -161,3 +161,19 @@ TEST_F(benchmark_test, lookahead_statements)
     // 2 lines skipped by lookahead + 1 which finds the symbol
     EXPECT_EQ(a->get_metrics().lookahead_statements, (size_t)3);
 }
+
+TEST_F(benchmark_test, using_evaluations)
+{
+    setUpAnalyzer(R"(
+    USING *,12
+A   DS    F
+B   DS    F
+    L     1,A
+    L     2,A
+    ST    1,B
+    ST    2,A
+)");
+    // A is resolved once, the repeated references are served from the cache
+    EXPECT_EQ(a->get_metrics().using_evaluations, (size_t)4);
+    EXPECT_EQ(a->get_metrics().using_evaluation_cache_hits, (size_t)2);
+}
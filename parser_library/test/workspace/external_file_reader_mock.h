@@ -14,6 +14,7 @@
 
 #include <optional>
 #include <string>
+#include <vector>
 
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
@@ -25,10 +26,21 @@
 namespace {
 struct external_file_reader_mock : hlasm_plugin::parser_library::workspaces::external_file_reader
 {
+    external_file_reader_mock()
+    {
+        ON_CALL(*this, load_texts).WillByDefault([this](auto locs) {
+            return external_file_reader::load_texts(std::move(locs));
+        });
+    }
+
     MOCK_METHOD(hlasm_plugin::utils::value_task<std::optional<std::string>>,
         load_text,
         (const hlasm_plugin::utils::resource::resource_location&),
         (const, override));
+    MOCK_METHOD(hlasm_plugin::utils::value_task<std::vector<std::optional<std::string>>>,
+        load_texts,
+        (std::vector<hlasm_plugin::utils::resource::resource_location>),
+        (const, override));
     MOCK_METHOD(hlasm_plugin::utils::value_task<hlasm_plugin::parser_library::workspaces::list_directory_result>,
         list_directory_files,
         (const hlasm_plugin::utils::resource::resource_location&),
@@ -30,6 +30,10 @@ public:
         add_file,
         (const resource_location&),
         (override));
+    MOCK_METHOD(value_task<std::vector<std::shared_ptr<hlasm_plugin::parser_library::workspaces::file>>>,
+        add_files,
+        (std::vector<resource_location>),
+        (override));
     MOCK_METHOD(std::shared_ptr<hlasm_plugin::parser_library::workspaces::file>,
         find,
         (const resource_location& key),
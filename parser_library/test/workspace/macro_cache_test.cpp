@@ -414,3 +414,79 @@ TEST(macro_cache_test, inline_depends_on_copy)
     file_mngr.did_change_file(copy_file_loc, 0, std::span(&simple_change, 1));
     EXPECT_FALSE(copy_c.load_from_cache(copy_key, new_ctx_2));
 }
+
+TEST(macro_cache_test, memory_usage)
+{
+    std::string opencode_file_name = "opencode";
+
+    std::string macro_file_name = "lib/MAC";
+    resource_location macro_file_loc(macro_file_name);
+    std::string macro_text =
+        R"( MACRO
+       MAC &PARAM
+       LR 15,1
+       LR 15,2
+       MEND
+)";
+
+    file_manager_impl file_mngr;
+    auto macro_file = open_file(macro_file_loc, macro_text, file_mngr);
+    macro_cache macro_c(file_mngr, macro_file);
+
+    const auto empty = macro_c.memory_usage();
+
+    auto ids = std::make_shared<context::id_storage>();
+    analyzing_context ctx = create_analyzing_context(opencode_file_name, ids);
+    save_dependency(macro_c, parse_dependency(macro_file, ctx, processing::processing_kind::MACRO));
+
+    EXPECT_GT(macro_c.memory_usage(), empty);
+}
+
+TEST(macro_cache_test, clone)
+{
+    std::string opencode_file_name = "opencode";
+
+    resource_location macro_file_loc("lib/MAC");
+    std::string macro_text =
+        R"( MACRO
+       MAC &PARAM,&KEY=1
+       COPY COPYFILE
+       MEND
+)";
+    resource_location copy_file_loc("lib/COPYFILE");
+    std::string copy_text = R"( LR 15,1)";
+
+    file_manager_impl file_mngr;
+    auto macro_file = open_file(macro_file_loc, macro_text, file_mngr);
+    auto copy_file = open_file(copy_file_loc, copy_text, file_mngr);
+    macro_cache macro_c(file_mngr, macro_file);
+    macro_cache copy_c(file_mngr, copy_file);
+
+    auto ids = std::make_shared<context::id_storage>();
+    analyzing_context ctx = create_analyzing_context(opencode_file_name, ids);
+    save_dependency(copy_c, parse_dependency(copy_file, ctx, processing::processing_kind::COPY));
+    save_dependency(macro_c, parse_dependency(macro_file, ctx, processing::processing_kind::MACRO));
+
+    constexpr context::id_index macro_id("MAC");
+    constexpr context::id_index copy_id("COPYFILE");
+    macro_cache_key macro_key { processing::processing_kind::MACRO, macro_id, {} };
+
+    const auto cloned = macro_c.clone();
+
+    analyzing_context original_ctx = create_analyzing_context(opencode_file_name, ids);
+    analyzing_context cloned_ctx = create_analyzing_context(opencode_file_name, ids);
+    EXPECT_EQ(macro_c.load_from_cache(macro_key, original_ctx), std::vector { copy_file });
+    EXPECT_EQ(cloned.load_from_cache(macro_key, cloned_ctx), std::vector { copy_file });
+
+    // the clone does not share the statement caches with the original
+    const auto* original = original_ctx.hlasm_ctx->get_macro_definition(macro_id);
+    const auto* copy = cloned_ctx.hlasm_ctx->get_macro_definition(macro_id);
+    ASSERT_TRUE(original && copy);
+    EXPECT_NE(original, copy);
+    EXPECT_NE(&original->cached_definition, &copy->cached_definition);
+    EXPECT_EQ(original->cached_definition.size(), copy->cached_definition.size());
+    EXPECT_EQ(copy->named_params().size(), original->named_params().size());
+    EXPECT_TRUE(copy->named_params().contains(context::id_index("KEY")));
+    EXPECT_NE(original_ctx.hlasm_ctx->get_copy_member(copy_id), cloned_ctx.hlasm_ctx->get_copy_member(copy_id));
+    EXPECT_EQ(copy->used_copy_members.count(cloned_ctx.hlasm_ctx->get_copy_member(copy_id)), 1);
+}
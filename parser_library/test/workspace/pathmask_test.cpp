@@ -18,11 +18,17 @@
 
 #include "workspaces/wildcard.h"
 
+using namespace hlasm_plugin::parser_library::workspaces;
+
 bool check_mask_matching(std::string_view pattern, std::string_view encoded_path)
 {
-    return std::regex_match(encoded_path.begin(),
-        encoded_path.end(),
-        hlasm_plugin::parser_library::workspaces::percent_encoded_pathmask_to_regex(pattern));
+    const bool result = std::regex_match(
+        encoded_path.begin(), encoded_path.end(), percent_encoded_pathmask_to_regex(pattern));
+
+    // the compiled matcher must agree with the regex
+    EXPECT_EQ(pathmask_matcher(pattern)(encoded_path), result) << pattern << " " << encoded_path;
+
+    return result;
 }
 
 TEST(percent_encoded_pathmask, pass)
@@ -197,3 +203,21 @@ TEST(percent_encoded_pathmask, fail)
     EXPECT_FALSE(check_mask_matching("file:///c%3A/path/**/", "file:///C%3A/Path/a/test/"));
     EXPECT_FALSE(check_mask_matching("file:///c%3A/path/**/test/", "file:///C%3A/path/a/tEst/"));
 }
+
+TEST(percent_encoded_pathmask, matcher_utf_8)
+{
+    for (std::string_view c : { "%E0%9F%80", "%E0%A0%80", "%ED%9F%BF", "%ED%A0%80", "%EE%80%80", "%F0%8F%80%80",
+             "%F0%90%80%80", "%F4%8F%BF%BF", "%F4%90%80%80", "%F5%80%80%80", "%C1%80", "%C2%80", "%C2", "%C2%8" })
+        check_mask_matching("/path/?/", std::string("/path/").append(c).append("/"));
+}
+
+TEST(percent_encoded_pathmask, matcher_long_path)
+{
+    std::string path = "file:///C%3A/ws/";
+    for (int i = 0; i < 200; ++i)
+        path.append("a/");
+
+    EXPECT_TRUE(pathmask_matcher("file:///C%3A/ws/**/a/**/a/")(path));
+    EXPECT_TRUE(pathmask_matcher("file:///C%3A/ws/*/**")(path));
+    EXPECT_FALSE(pathmask_matcher("file:///C%3A/ws/**/b/**")(path));
+}
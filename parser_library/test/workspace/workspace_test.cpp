@@ -436,6 +436,38 @@ TEST_F(workspace_test, did_close_file)
     EXPECT_TRUE(extract_diags(ws, ws_cfg).empty());
 }
 
+TEST_F(workspace_test, reparse_dependants_of_changed_file)
+{
+    file_manager_extended file_manager;
+    workspace_configuration ws_cfg(file_manager, ws_loc, global_settings, config, nullptr, nullptr);
+    workspace ws(file_manager, ws_cfg);
+
+    ws_cfg.parse_configuration_file().run();
+    run_if_valid(ws.did_open_file(source1_loc));
+    run_if_valid(ws.did_open_file(source2_loc));
+    run_if_valid(ws.did_open_file(source3_loc));
+    parse_all_files(ws);
+
+    const auto reparsed = [&ws]() {
+        std::set<resource_location> result;
+        for (auto t = ws.parse_file(); t.valid(); t = ws.parse_file())
+            result.insert(t.run().value().filename);
+        return result;
+    };
+
+    // only the programs using the ERROR macro are affected
+    run_if_valid(ws.mark_file_for_parsing(faulty_macro_loc, file_content_state::changed_content));
+    EXPECT_EQ(reparsed(), (std::set { source1_loc, source2_loc }));
+
+    run_if_valid(ws.did_close_file(source1_loc));
+    run_if_valid(ws.mark_file_for_parsing(faulty_macro_loc, file_content_state::changed_content));
+    EXPECT_EQ(reparsed(), (std::set { source2_loc }));
+
+    run_if_valid(ws.did_close_file(source2_loc));
+    run_if_valid(ws.mark_file_for_parsing(faulty_macro_loc, file_content_state::changed_content));
+    EXPECT_TRUE(reparsed().empty());
+}
+
 TEST_F(workspace_test, did_close_file_without_save)
 {
     file_manager_extended file_manager;
@@ -711,6 +743,68 @@ TEST_F(workspace_test, use_external_library_with_workspace_uri)
     EXPECT_TRUE(extract_diags(ws, ws_cfg).empty());
 }
 
+TEST_F(workspace_test, prefetch_closed_dependencies)
+{
+    NiceMock<external_file_reader_mock> external_files;
+    file_manager_impl fm(external_files, nullptr);
+
+    fm.did_open_file(pgm_conf_loc, 1, R"({
+  "pgms": [
+    {
+      "program": "source1",
+      "pgroup": "P1"
+    }
+  ]
+})");
+    fm.did_open_file(proc_grps_loc, 1, R"({
+  "pgroups": [
+    {
+      "name": "P1",
+      "libs": [ {"dataset": "REMOTE.DATASET"} ]
+    }
+  ]
+})");
+    const resource_location mac1("hlasm-external:/DATASET/REMOTE.DATASET/MAC1");
+    const resource_location mac2("hlasm-external:/DATASET/REMOTE.DATASET/MAC2");
+    const std::string mac1_text = " MACRO\n MAC1\n MEND\n";
+    const std::string mac2_text = " MACRO\n MAC2\n MEND\n";
+    fm.did_open_file(source1_loc, 1, " MAC1\n MAC2\n");
+    fm.did_open_file(mac1, 1, mac1_text);
+    fm.did_open_file(mac2, 1, mac2_text);
+
+    workspace_configuration ws_cfg(fm, ws_loc, global_settings, config, nullptr, nullptr);
+    workspace ws(fm, ws_cfg);
+    ws_cfg.parse_configuration_file().run();
+
+    EXPECT_CALL(external_files, list_directory_files(resource_location("hlasm-external:/DATASET/REMOTE.DATASET")))
+        .WillRepeatedly(Invoke([&mac1, &mac2]() {
+            return value_task<list_directory_result>::from_value(
+                { { { "MAC1", mac1 }, { "MAC2", mac2 } }, path::list_directory_rc::done });
+        }));
+
+    run_if_valid(ws.did_open_file(source1_loc));
+    parse_all_files(ws);
+    EXPECT_TRUE(extract_diags(ws, ws_cfg).empty());
+
+    // both closed macros are requested together, the failed one is then loaded individually
+    EXPECT_CALL(external_files, load_texts(UnorderedElementsAre(mac1, mac2))).WillOnce(Invoke([&](auto locs) {
+        std::vector<std::optional<std::string>> result;
+        for (const auto& loc : locs)
+            result.emplace_back(loc == mac1 ? std::optional(mac1_text) : std::nullopt);
+        return value_task<std::vector<std::optional<std::string>>>::from_value(std::move(result));
+    }));
+    EXPECT_CALL(external_files, load_text(mac2)).WillOnce(Invoke([&mac2_text]() {
+        return value_task<std::optional<std::string>>::from_value(mac2_text);
+    }));
+    EXPECT_CALL(external_files, load_text(mac1)).Times(0);
+
+    fm.did_close_file(mac1);
+    fm.did_close_file(mac2);
+    run_if_valid(ws.mark_file_for_parsing(source1_loc, file_content_state::changed_content));
+    parse_all_files(ws);
+    EXPECT_TRUE(extract_diags(ws, ws_cfg).empty());
+}
+
 TEST_F(workspace_test, track_nested_dependencies)
 {
     file_manager_extended file_manager;
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2025 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#ifndef HLASMPLUGIN_UTILS_MEMORY_USAGE_H
+#define HLASMPLUGIN_UTILS_MEMORY_USAGE_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// Rough estimates of heap memory held by standard containers. Only the storage owned directly by the container is
+// counted, the nested allocations of elements have to be added by the caller.
+namespace hlasm_plugin::utils::memory_usage {
+
+// bookkeeping of a single heap allocation
+constexpr std::size_t allocation_overhead = 2 * sizeof(void*);
+
+inline std::size_t heap(const std::string& s) noexcept
+{
+    // small strings are stored inline
+    return s.capacity() > std::string().capacity() ? s.capacity() + 1 + allocation_overhead : 0;
+}
+
+template<typename T>
+std::size_t heap(const std::vector<T>& v) noexcept
+{
+    return v.capacity() ? v.capacity() * sizeof(T) + allocation_overhead : 0;
+}
+
+// node based containers (std::map, std::set, std::unordered_*)
+template<typename C>
+std::size_t nodes(const C& c) noexcept
+{
+    constexpr std::size_t node_links = 3 * sizeof(void*);
+    std::size_t result = c.size() * (sizeof(typename C::value_type) + node_links + allocation_overhead);
+    if constexpr (requires { c.bucket_count(); })
+        result += c.bucket_count() * sizeof(void*);
+    return result;
+}
+
+} // namespace hlasm_plugin::utils::memory_usage
+
+#endif
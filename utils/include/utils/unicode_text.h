@@ -70,6 +70,9 @@ character_replaced append_utf8_sanitized(std::string& result, std::string_view s
 
 bool utf8_one_byte_begin(char ch);
 
+// returns the length of the longest prefix consisting of ASCII characters only
+size_t ascii_prefix_length(std::string_view s) noexcept;
+
 std::string replace_non_utf8_chars(std::string_view text);
 
 // skip <count> UTF-8 characters
@@ -16,6 +16,13 @@
 
 #include <algorithm>
 #include <bit>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    include <emmintrin.h>
+#    define HLASM_UTILS_ASCII_SSE2
+#endif
 
 namespace hlasm_plugin::utils {
 constinit const std::array<char_size, 256> utf8_prefix_sizes = []() {
@@ -131,6 +138,36 @@ bool utf8_four_byte_begin(char ch)
     return (ch & 0xF8) == 0xF0; // 11110xxx
 }
 
+size_t ascii_prefix_length(std::string_view s) noexcept
+{
+    const char* const begin = s.data();
+    const char* p = begin;
+    const char* const end = begin + s.size();
+
+#ifdef HLASM_UTILS_ASCII_SSE2
+    for (; end - p >= 16; p += 16)
+    {
+        const auto mask = _mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)));
+        if (mask)
+            return p - begin + std::countr_zero(static_cast<unsigned>(mask));
+    }
+#endif
+
+    static constexpr std::uint64_t high_bits = 0x8080808080808080ULL;
+    for (; end - p >= 8; p += 8)
+    {
+        std::uint64_t v;
+        std::memcpy(&v, p, sizeof(v));
+        if (v & high_bits)
+            break;
+    }
+
+    while (p != end && static_cast<unsigned char>(*p) < 0x80)
+        ++p;
+
+    return p - begin;
+}
+
 std::string replace_non_utf8_chars(std::string_view text)
 {
     std::string ret;
@@ -229,3 +229,24 @@ TEST(extract_utf32_from_utf8, four)
     const char8_t input[] = u8"\U00010041";
     EXPECT_EQ(extract_utf32_from_utf8(reinterpret_cast<const char*>(input)), U'\U00010041');
 }
+
+TEST(ascii_prefix_length, basic)
+{
+    EXPECT_EQ(ascii_prefix_length(""), 0);
+    EXPECT_EQ(ascii_prefix_length("A"), 1);
+    EXPECT_EQ(ascii_prefix_length("LABEL    LR    1,2"), 18);
+    EXPECT_EQ(ascii_prefix_length("\xC4\x8D"), 0);
+}
+
+TEST(ascii_prefix_length, non_ascii_at_every_position)
+{
+    const std::string base(70, 'A');
+    for (size_t i = 0; i < base.size(); ++i)
+    {
+        auto s = base;
+        s[i] = '\xFF';
+        EXPECT_EQ(ascii_prefix_length(s), i) << i;
+        EXPECT_EQ(ascii_prefix_length(std::string_view(s).substr(i + 1)), base.size() - i - 1) << i;
+    }
+    EXPECT_EQ(ascii_prefix_length(base), base.size());
+}